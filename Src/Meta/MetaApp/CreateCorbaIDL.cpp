@@ -103,7 +103,7 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
                          | std::views::join;
 
    auto all_datatypes  = all_attributes
-                         | std::views::transform([](auto const& a) { return a.Table().Dictionary().FindDataType(a.DataType()); })
+                         | std::views::transform([](auto const& a) { return a.GetDataType(); })
                          | std::ranges::to<std::set>();
 
    auto all_includes = all_datatypes | std::views::transform([](auto const& d) { return d.CorbaModule(); }) 
@@ -137,23 +137,23 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
       bool has_prim_type = false;
       if(auto prim_attr = table.Attributes() | own::views::primary; !prim_attr.empty()) {
          has_prim_type = true;
-         out << std::format("{}struct {}_primary {{\n", my_indent(1), table.SourceName());
+         out_format(out, "{}struct {}_primary {{\n", my_indent(1), table.SourceName());
       
-         auto prim_datatypes = prim_attr | std::views::transform([this](auto const& val) { return FindDataType(val.DataType()); });
+         auto prim_datatypes = prim_attr | std::views::transform([](auto const& val) { return val.GetDataType(); });
          auto prim_attr_max_length = std::ranges::max(prim_datatypes | std::views::transform([](auto const& d) { return d.CorbaType().size(); }));
          for(auto const& [attr, dtype] : std::views::zip(prim_attr, prim_datatypes)) {
-            out << std::format("{}{:<{}} {};\n", my_indent(2), dtype.CorbaType(), prim_attr_max_length, attr.Name());
+            out_format(out, "{}{:<{}} {};\n", my_indent(2), dtype.CorbaType(), prim_attr_max_length, attr.Name());
             }
 
          out << my_indent(2) << "};\n\n";
          }
 
 
-      out << std::format("{}interface {}", my_indent(1), table.SourceName());
+      out_format(out, "{}interface {}", my_indent(1), table.SourceName());
 
       if (!parents.empty()) {
          size_t i = 0;
-         std::ranges::for_each(parents, [this, &out, &table, &i](auto const& p) {
+         std::ranges::for_each(parents, [this, &out, &table, &i](TMyTable const& p) {
             out << (i++ > 0 ? ", " : ": ") 
                 << (FindNameSpace(table.Namespace()).CorbaName() != FindNameSpace(p.Namespace()).CorbaName() ? 
                          FindNameSpace(p.Namespace()).CorbaName() + "::"s + p.Name()
@@ -171,13 +171,13 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
       if (table.EntityType() != EMyEntityType::view && std::ranges::any_of(processing_data, [](auto const& p) { return !std::get<0>(p).IsComputed(); })) {
          auto attr_txt = [&comp_attr]() { return !comp_attr.empty() ? "attribute          "s : "attribute "s; }();
          for (auto const& [attr, dtype] : processing_data | std::views::filter([](auto const& val) { return !val.first.IsComputed(); })) {
-            out << std::format("{}{}{:<{}} {};\n", my_indent(2), attr_txt, dtype.CorbaType(), attr_max_length, attr.Name());
+            out_format(out, "{}{}{:<{}} {};\n", my_indent(2), attr_txt, dtype.CorbaType(), attr_max_length, attr.Name());
             }
          }
 
       if (!comp_attr.empty()) {
          for (auto const& [attr, dtype] : comp_attr) {
-            out << std::format("{}readonly attribute {:<{}} {};\n", my_indent(2), dtype.CorbaType(), attr_max_length, attr.Name());
+            out_format(out, "{}readonly attribute {:<{}} {};\n", my_indent(2), dtype.CorbaType(), attr_max_length, attr.Name());
             }
          }
 
@@ -197,21 +197,21 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
          std::ranges::sort(buildfunc, [](auto const& lhs, auto const& rhs) { return std::get<1>(lhs) < std::get<1>(rhs); });
 
          for(auto const& [ret_type, func, _] : buildfunc) {
-            out << std::format("{}{:<{}} {}();\n", my_indent(2), ret_type, ret_max_length, func);
+            out_format(out, "{}{:<{}} {}();\n", my_indent(2), ret_type, ret_max_length, func);
             }          
          }
 
       if(has_prim_type) {
          out << '\n';
-         out << std::format("{}{}_primary GetPrimary();\n", my_indent(2), table.SourceName());
+         out_format(out, "{}{}_primary GetPrimary();\n", my_indent(2), table.SourceName());
          }
 
       if(auto buildfunc = GetRangeValues(table); !buildfunc.empty()) {
          auto ret_max_length = std::ranges::max(buildfunc | std::views::transform([](auto const& b) { return std::get<2>(b).size(); }));
          out << '\n';
          for (auto const& [ret_type, func, ret_type_all, func_all, _] : buildfunc) {
-            out << std::format("{}{:<{}} {}();\n", my_indent(2), ret_type, ret_max_length, func);
-            out << std::format("{}{:<{}} {}();\n", my_indent(2), ret_type_all, ret_max_length, func_all);
+            out_format(out, "{}{:<{}} {}();\n", my_indent(2), ret_type, ret_max_length, func);
+            out_format(out, "{}{:<{}} {}();\n", my_indent(2), ret_type_all, ret_max_length, func_all);
             }
 
           }
@@ -219,10 +219,10 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
       out << "\n      };\n\n";
 
       if (has_prim_type) {
-         out << std::format("{0:}typedef sequence<{1:}_primary> {1:}_primarySeq;\n", my_indent(1), table.SourceName());
+         out_format(out, "{0:}typedef sequence<{1:}_primary> {1:}_primarySeq;\n", my_indent(1), table.SourceName());
          }
 
-      out << std::format("{0:}typedef sequence<{1:}> {1:}Seq;\n\n", my_indent(1), table.SourceName());
+      out_format(out, "{0:}typedef sequence<{1:}> {1:}Seq;\n\n", my_indent(1), table.SourceName());
       }
    if (strModule.size() > 0) out << "   };\n\n";
 
@@ -248,7 +248,7 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
    */
   
    for(auto const& [type, table] : all_tables) {
-      out << std::format("{}{:<{}} {}();\n", my_indent(2), type, max_type_length, table);
+      out_format(out, "{}{:<{}} {}();\n", my_indent(2), type, max_type_length, table);
       }
    }
    out << "\n";
@@ -258,8 +258,8 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
                                std::string const& strModule = FindNameSpace(t.Namespace()).CorbaName();
                                auto table_keys = t.Attributes() 
                                                          | std::views::filter([](auto const& a) { return a.Primary(); })
-                                                         | std::views::transform([this](auto const& attr) { 
-                                                                 return std::make_tuple(FindDataType(attr.DataType()).CorbaType(),
+                                                         | std::views::transform([](auto const& attr) { 
+                                                                 return std::make_tuple(attr.GetDataType().CorbaType(),
                                                                                         "p"s + attr.Name() ); 
                                                                  })
                                                          | std::ranges::to<std::vector>();
@@ -270,9 +270,9 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
       auto max_type_length = std::ranges::max(all_tables | std::views::transform([](auto const& d) { return std::get<0>(d).size(); }));
 
       for (auto const& [type, func_name, key_attr] : all_tables) {
-         out << std::format("{}{:<{}} {}(", my_indent(2), type, max_type_length, func_name);
+         out_format(out, "{}{:<{}} {}(", my_indent(2), type, max_type_length, func_name);
          for(size_t pos = 0u; auto const& [key_type, key_name] : key_attr) {
-            out << std::format("{}{} {}", (pos++ > 0 ? ", in " : "in "), key_type, key_name);
+            out_format(out, "{}{} {}", (pos++ > 0 ? ", in " : "in "), key_type, key_name);
             }
          out << ");\n";
       }
@@ -292,7 +292,7 @@ bool TMyDictionary::CreateCorbaIDL(std::ostream& out) const {
 
 
    bool TMyDictionary::CreateCorbaImplementationSource(std::ostream& out, std::string const& strHeader) const {
-      out << std::format("#include \"{}\"\n\n", strHeader);
+      out_format(out, "#include \"{}\"\n\n", strHeader);
       return true;
       }
 
@@ -8,13 +8,13 @@ using namespace std::string_literals;
 
 template <bool boNeedKey = true>
 bool CreateReadData(TMyTable const& table, std::ostream& os) {
-   os << std::format("/// method to read data from the table {}\n", table.SQLName());
+   out_format(os, "/// method to read data from the table {}\n", table.SQLName());
    return true;
    }
 
 template <bool boKey = true>
 bool CreateWriteData(TMyTable const& table, std::ostream& os) {
-   os << std::format("/// method to write data in the table {}\n", table.SQLName());
+   out_format(os, "/// method to write data in the table {}\n", table.SQLName());
 
    return true;
    }
@@ -69,14 +69,14 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          << "concept my_dataclasses =\n";
       {
       auto const& [_, table] = *std::begin(Tables());
-      os << std::format("          (std::is_same_v<ty, {}> ||\n", table.FullClassName());
+      out_format(os, "          (std::is_same_v<ty, {}> ||\n", table.FullClassName());
       }
       for (auto const& table : Tables() | own::views::second | std::views::drop(1) | std::views::take(Tables().size() - 2)) {
-         os << std::format("           std::is_same_v<ty, {}> ||\n", table.FullClassName());
+         out_format(os, "           std::is_same_v<ty, {}> ||\n", table.FullClassName());
          }
       
       if(auto it = std::prev(Tables().end()); it != Tables().end()) {
-         os << std::format("           std::is_same_v<ty, {}>) &&\n", it->second.FullClassName());
+         out_format(os, "           std::is_same_v<ty, {}>) &&\n", it->second.FullClassName());
          }
 
       os << "          requires {\n"
@@ -92,11 +92,11 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
       os << "template <typename ty>\n"
          << "concept my_data_primkey =\n";
       for (auto const& table : Tables() | own::views::second | std::views::take(Tables().size() - 1)) {
-         os << std::format("          std::is_same_v<ty, {}::primary_key> ||\n", table.FullClassName());
+         out_format(os, "          std::is_same_v<ty, {}::primary_key> ||\n", table.FullClassName());
          }
 
       if (auto it = std::prev(Tables().end()); it != Tables().end()) {
-         os << std::format("          std::is_same_v<ty, {}::primary_key>;\n\n", it->second.FullClassName());
+         out_format(os, "          std::is_same_v<ty, {}::primary_key>;\n\n", it->second.FullClassName());
          }
 
 
@@ -104,6 +104,13 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          << "concept my_datacontainer =\n"
          << "      (own::is_vector_v<ty> && my_dataclasses<typename ty::value_type>) ||\n"
          << "      (own::is_set_v<ty> && my_dataclasses<typename ty::key_type>) ||\n"
+         << "      (own::is_columns_v<ty> && my_dataclasses<typename ty::value_type>) ||\n"
+         << "      (own::is_hash_map_v<ty> &&\n"
+         << "                     my_dataclasses<typename ty::mapped_type> &&\n"
+         << "                     std::is_same_v<typename ty::key_type, typename ty::mapped_type::primary_key>) ||\n"
+         << "      (own::is_flat_map_v<ty> &&\n"
+         << "                     my_dataclasses<typename ty::mapped_type> &&\n"
+         << "                     std::is_same_v<typename ty::key_type, typename ty::mapped_type::primary_key>) ||\n"
          << "      (own::is_map_v<ty> &&\n"
          << "                     my_dataclasses<typename ty::mapped_type> &&\n"
          << "                     std::is_same_v<typename ty::key_type, typename ty::mapped_type::primary_key>);\n\n";
@@ -130,7 +137,7 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
 
       auto WriteGet4Table = [&os](auto const& table) {
          for (auto const& attr : table.Attributes()) {
-            auto const& datatype = table.Dictionary().FindDataType(attr.DataType());
+            auto const& datatype = attr.GetDataType();
             os << "            data." << attr.Name() << "(query.Get<" << datatype.SourceType() << ">(\"" << attr.Name() << "\"";
             if (attr.Primary()) os << ", true";
             os << "));\n";
@@ -140,12 +147,12 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
 
       { 
          auto const& table = std::begin(Tables())->second;
-         os << std::format("         if constexpr (std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
+         out_format(os, "         if constexpr (std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
          WriteGet4Table(table);
          os << "            }\n";
          }
       for(auto const& table :Tables() | own::views::second | std::views::drop(1))   {
-         os << std::format("         else if constexpr(std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
+         out_format(os, "         else if constexpr(std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
          WriteGet4Table(table);
          os << "            }\n";
          }
@@ -164,18 +171,18 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          os //<< std::format("               auto const& strSQLQuery = {};\n", std::format(GetSQLQueryName<EQueryType::SelectPrim>(), table.Name()))
             << std::format("               query.SetSQL({});\n", std::format(GetSQLQueryName<EQueryType::SelectPrim>(), table.Name()));
          for (auto const& attr : table.Attributes() | own::views::primary) {
-            os << std::format("               query.Set(\"key{0:}\", key_val.{0:}());\n", attr.Name());
+            out_format(os, "               query.Set(\"key{0:}\", key_val.{0:}());\n", attr.Name());
             }
          os << "               }\n";
          };
 
       {
          auto const& [_, table] = *std::begin(Tables());
-         os << std::format("            if constexpr (std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
+         out_format(os, "            if constexpr (std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
          primkey2table(table);
          }
       for (auto const& table : Tables() | own::views::second | std::views::drop(1)) {
-         os << std::format("            else if constexpr (std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
+         out_format(os, "            else if constexpr (std::is_same_v<data_ty, {}>) {{\n", table.FullClassName());
          primkey2table(table);
          }
       os << "            else static_assert(own::always_false<data_ty>, \"unexpected datatype for this class\");\n\n";
@@ -216,6 +223,8 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          }
 
       os << "            else static_assert(own::always_false<used_type>, \"unexpected datatype for this class\");\n\n"
+         << "            // rows for own::flat_map, sorted once after the query\n"
+         << "            [[maybe_unused]] std::vector<std::pair<typename used_type::primary_key, used_type>> bulk;\n"
          << "            for (query.Execute(), query.First(); !query.IsEof(); query.Next()) {\n"
          << "               auto dataset = GetTuple<used_type>(query);\n"
          << "               if constexpr (own::is_vector<data_ty>::value) {\n"
@@ -224,14 +233,22 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          << "               else  if constexpr (own::is_set<data_ty>::value) {\n"
          << "                  data.emplace(std::move(dataset));\n"
          << "                  }\n"
-         << "               else if constexpr (own::is_map<data_ty>::value) {\n"
+         << "               else if constexpr (own::is_map<data_ty>::value || own::is_hash_map<data_ty>::value) {\n"
          << "                  auto keyval = dataset.GetKey();\n"
          << "                  data.emplace(std::move(keyval), std::move(dataset));\n"
          << "                  }\n"
+         << "               else if constexpr (own::is_columns<data_ty>::value) {\n"
+         << "                  data.push_back(dataset);\n"
+         << "                  }\n"
+         << "               else if constexpr (own::is_flat_map<data_ty>::value) {\n"
+         << "                  auto keyval = dataset.GetKey();\n"
+         << "                  bulk.emplace_back(std::move(keyval), std::move(dataset));\n"
+         << "                  }\n"
          << "               else {\n"
          << "                  static_assert(own::always_false<data_ty>::value, \"unexpected container type\");\n"
          << "                  }\n"
          << "               }\n"
+         << "            if constexpr (own::is_flat_map<data_ty>::value) data.insert_bulk(std::move(bulk));\n"
          << "            return data;\n"
          << "            }\n\n";
 
@@ -245,6 +262,8 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          << "         query.SetSQL(strSQL);\n"
          << "         query.Set(params);\n\n"
 
+         << "         // rows for own::flat_map, sorted once after the query\n"
+         << "         [[maybe_unused]] std::vector<std::pair<typename used_type::primary_key, used_type>> bulk;\n"
          << "         for (query.Execute(), query.First(); !query.IsEof(); query.Next()) {\n"
          << "            auto dataset = GetTuple<used_type>(query);\n"
          << "            if constexpr (own::is_vector<data_ty>::value) {\n"
@@ -253,14 +272,22 @@ bool TMyDictionary::CreateReaderHeader(std::ostream& os) const {
          << "            else  if constexpr (own::is_set<data_ty>::value) {\n"
          << "               data.emplace(std::move(dataset));\n"
          << "               }\n"
-         << "            else if constexpr (own::is_map<data_ty>::value) {\n"
+         << "            else if constexpr (own::is_map<data_ty>::value || own::is_hash_map<data_ty>::value) {\n"
          << "               auto keyval = dataset.GetKey();\n"
          << "               data.emplace(std::move(keyval), std::move(dataset));\n"
          << "               }\n"
+         << "            else if constexpr (own::is_columns<data_ty>::value) {\n"
+         << "               data.push_back(dataset);\n"
+         << "               }\n"
+         << "            else if constexpr (own::is_flat_map<data_ty>::value) {\n"
+         << "               auto keyval = dataset.GetKey();\n"
+         << "               bulk.emplace_back(std::move(keyval), std::move(dataset));\n"
+         << "               }\n"
          << "            else {\n"
          << "               static_assert(own::always_false<data_ty>::value, \"unexpected container type\");\n"
          << "               }\n"
          << "            }\n"
+         << "         if constexpr (own::is_flat_map<data_ty>::value) data.insert_bulk(std::move(bulk));\n"
          << "         return data;\n"
          << "         }\n\n";
 
@@ -377,24 +404,34 @@ bool TMyDictionary::CreateReaderSource(std::ostream& os) const {
 
 
       for (auto const& [_, table] : Tables()) {
-         os << std::format("// access methods for class {}\n", table.ClassName());
-         os << std::format("bool {1}::Read({0}::container_ty& data) {{\n", table.FullClassName(), PersistenceClass());
+         out_format(os, "// access methods for class {}\n", table.ClassName());
+         out_format(os, "bool {1}::Read({0}::container_ty& data) {{\n", table.FullClassName(), PersistenceClass());
+         bool const boFlatMap = table.ContainerType() == EMyContainerType::flat_map;
          os << "   auto query = database.CreateQuery();\n"
-            << "   query.SetSQL(" << "strSQLSelect" << table.Name() << "_All);\n"
-            << "   for(query.Execute(), query.First();!query.IsEof();query.Next()) {\n"
+            << "   query.SetSQL(" << "strSQLSelect" << table.Name() << "_All);\n";
+         if (boFlatMap) out_format(os, "   {}::container_ty::container_type elements;   // sorted once after the query\n", table.FullClassName());
+         os << "   for(query.Execute(), query.First();!query.IsEof();query.Next()) {\n"
             << "      " << table.FullClassName() << " element;\n";
          for(auto const& attr : table.Attributes()) {
-            auto const& datatype = table.Dictionary().FindDataType(attr.DataType());
+            auto const& datatype = attr.GetDataType();
             os << "      element." << attr.Name() << "(query.Get<" << datatype.SourceType() << ">(\"" << attr.Name() << "\"";
             if (attr.Primary()) os << ", true";
             os << "));\n";
             }
-         os << "      data.insert({ element.GetKey(), element });\n"
-            << "      }\n";
+         if (boFlatMap) {
+            os << "      auto keyval = element.GetKey();\n"
+               << "      elements.emplace_back(std::move(keyval), std::move(element));\n"
+               << "      }\n"
+               << "   data.insert_bulk(std::move(elements));\n";
+            }
+         else {
+            os << "      data.insert({ element.GetKey(), element });\n"
+               << "      }\n";
+            }
 
          os << "   return true;\n"
             << "   }\n\n";
-         os << std::format("bool {1}::Read({0}::primary_key const& key_val, {0}& data) {{\n", table.FullClassName(), PersistenceClass());
+         out_format(os, "bool {1}::Read({0}::primary_key const& key_val, {0}& data) {{\n", table.FullClassName(), PersistenceClass());
          os << "   auto query = database.CreateQuery();\n"
             << "   query.SetSQL(" << "strSQLSelect" << table.Name() << "_Detail);\n";
 
@@ -407,7 +444,7 @@ bool TMyDictionary::CreateReaderSource(std::ostream& os) const {
             << "   if(!query.IsEof()) {\n";
          
          for (auto const& attr : table.Attributes()) {
-            auto const& datatype = table.Dictionary().FindDataType(attr.DataType());
+            auto const& datatype = attr.GetDataType();
             os << "      data." << attr.Name() << "(query.Get<" << datatype.SourceType() << ">(\"" << attr.Name() << "\"";
             if (attr.Primary()) os << ", true";
             os << "));\n";
@@ -432,7 +469,7 @@ bool TMyDictionary::CreateReaderSource(std::ostream& os) const {
          << std::format("      bool Delete({0}::primary_key const&);\n", table.FullClassName())
             << std::format("      bool Update({0}::primary_key const&, {0} const&, bool = false);\n", table.FullClassName())
 
-         os << std::format("bool {1}::Read({0}::primary_key const& key_val, {0}& data) {{\n", table.FullClassName(), PersistenceClass());
+         out_format(os, "bool {1}::Read({0}::primary_key const& key_val, {0}& data) {{\n", table.FullClassName(), PersistenceClass());
          os << "   auto query = database.CreateQuery();\n"
             << "   query.SetSQL(" << "strSQL" << table.Name() << "SelectDetail);\n";
 
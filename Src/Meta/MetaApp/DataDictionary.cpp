@@ -21,6 +21,10 @@
 #include "DataDictionary.h"
 #include "GenerateSQL.h"     // order is important for .inl file 
 #include "DictionaryHelper.h"
+#include "MyJobScheduler.h"
+#include "MyOutputWriter.h"
+#include "MyUTF8Stream.h"
+#include "MyInstrumentation.h"
 
 #include <sstream>
 #include <fstream>
@@ -40,67 +44,10 @@
 #include <cctype>
 #include <locale>
 
-#include <windows.h>
-
 
 namespace fs = std::filesystem;
 using namespace std::string_literals;
 
-/// \brief convert an ANSI file to UTF-8 + BOM (this method is Windows-specific and must be adapted for other platforms)
-/// \todo check error messages with system_error 
-void convertToUTF8WithBOM(fs::path const& filePath) {
-   std::ifstream inputFile(filePath);
-   if (!inputFile.is_open()) {
-      throw std::runtime_error("Error when opening the input file \""s + filePath.string() + "\"."s);
-      }
-
-   std::string tmpFile = filePath.string() + ".tmp";
-   std::ofstream outputFile(tmpFile);
-   if (!outputFile.is_open()) {
-      throw std::runtime_error("Error when opening the output file \""s + tmpFile + "\"."s);
-      }
-
-   // write BOM (Byte Order Mark) for UTF-8 in the output file
-   outputFile.put(static_cast<char>(0xEF));
-   outputFile.put(static_cast<char>(0xBB));
-   outputFile.put(static_cast<char>(0xBF));
-
-   // perform conversion line by line
-   std::string line;
-   while (std::getline(inputFile, line)) {
-      // convert a ANSI to a UTF-8 using windows specific function MultiByteToWideChar and write this directly to the output file
-      int utf8_length = ::MultiByteToWideChar(CP_ACP, 0, line.c_str(), -1, NULL, 0);  
-      if (utf8_length == 0) {  // must be > 0 for an empty line too because its contain '\0'
-         throw std::runtime_error("error when determining the UTF-8 length in \""s + line + "\"."s);
-         }
-
-      std::wstring utf16_string(utf8_length, L'\0');
-      if (!::MultiByteToWideChar(CP_ACP, 0, line.c_str(), -1, &utf16_string[0], utf8_length)) {
-         throw std::runtime_error("error when converting from ANSI to UTF-16 in \""s + line + "\"."s);
-         }
-
-      int utf8_buffer_size = ::WideCharToMultiByte(CP_UTF8, 0, utf16_string.c_str(), -1, NULL, 0, NULL, NULL);
-      if (utf8_buffer_size == 0) {
-         throw std::runtime_error("error when determining the UTF - 8 buffer size in \""s + line + "\"."s);
-         }
-
-      std::string utf8_string(utf8_buffer_size - 1, '\0'); // -1, to ignore the NULL character at the end
-      if (!::WideCharToMultiByte(CP_UTF8, 0, utf16_string.c_str(), -1, &utf8_string[0], utf8_buffer_size, NULL, NULL)) {
-         throw std::runtime_error("Error when converting from UTF-16 to UTF-8 in \""s + line + "\"."s);
-         }
-
-      outputFile << utf8_string << "\n";
-      }
-
-   // close files before deleting and renaming
-   inputFile.close();
-   outputFile.close();
-
-   // delete original file and rename temporary file
-   fs::remove(filePath);
-   fs::rename(tmpFile, filePath);
-   }
-
 // ---------------------------------------------------------------------------------------------------------------------------
 // TMyAttribute
 
@@ -112,20 +59,12 @@ std::tuple<std::string, bool, std::string, std::string, std::string, std::string
    }
 */
 TMyAttribute& TMyAttribute::AddDescription(std::string const& pText) {
-   if (Description().size() > 0) {
-      Description() += "\n"s;
-      Description() += pText;
-      }
-   else Description() = pText;
+   std::get<14>(data) = Table().Dictionary().Texts().Concat(Description(), "\n"sv, pText);
    return *this;
    }
 
 TMyAttribute& TMyAttribute::AddComment(std::string const& pText) {
-   if (Comment().size() > 0) {
-      Comment() += "\n"s;
-      Comment() += pText;
-      }
-   else Comment() = pText;
+   std::get<15>(data) = Table().Dictionary().Texts().Concat(Comment(), "\n"sv, pText);
    return *this;
    }
 
@@ -141,7 +80,8 @@ std::string TMyAttribute::Comment_Attribute() const {
    }
 
 TMyDatatype const& TMyAttribute::GetDataType() const {
-   return Table().Dictionary().FindDataType(DataType());
+   if (resolved_datatype) [[likely]] return *resolved_datatype;
+   else return Table().Dictionary().FindDataType(DataType());
    }
 
 // TMyReferences
@@ -158,6 +98,21 @@ std::string TMyReferences::ReferenceTypeTxt() const {
       }
    }
 
+TMyTable const& TMyReferences::GetRefTable() const {
+   if (resolved_table) [[likely]] return *resolved_table;
+   else return Table().Dictionary().FindTable(RefTable());
+   }
+
+std::vector<TMyReferences::my_joined_attributes> TMyReferences::JoinedAttributes() const {
+   auto const& ref_table = GetRefTable();
+   std::vector<my_joined_attributes> joined;
+   joined.reserve(Values().size());
+   for (auto const& [own_id, ref_id] : Values()) {
+      joined.push_back({ Table().FindAttribute(own_id), ref_table.FindAttribute(ref_id) });
+      }
+   return joined;
+   }
+
 
 
 
@@ -176,47 +131,36 @@ std::string TMyTable::EntityTypeTxt() const {
 
 std::set<std::string> TMyTable::GetPrecursors(bool boAll) const {
    std::set<std::string> retval ;
-   // seek all generalizations
-   auto parents = References() | std::views::filter([](auto const& r) { 
-                                            return r.ReferenceType() == EMyReferenceType::generalization ||
-                                                   r.ReferenceType() == EMyReferenceType::composition ||
-                                                   r.ReferenceType() == EMyReferenceType::range; })
-                               | std::views::transform([this](auto const& r) { return Dictionary().FindTable(r.RefTable()).Name(); })
-                               ;
-
-   std::ranges::copy(parents, std::inserter(retval, retval.end()));
-
-   if (boAll) {
-      std::ranges::for_each(parents, [this, &retval](std::string const& tab) {
-         auto succ = Dictionary().FindTable(tab).GetPrecursors(true);
-         std::ranges::copy(succ, std::inserter(retval, retval.end()));
-         });
-   }
-
+   if (boAll) {  // transitive closure of the dictionary, the ids are in the sequence of the names
+      auto const& link = Dictionary().Linkage();
+      for (auto id : Dictionary().Precursors(*this)) retval.emplace_hint(retval.end(), link.tables_by_id[id]->Name());
+      }
+   else {
+      // seek all generalizations
+      auto parents = References() | std::views::filter([](auto const& r) { 
+                                               return r.ReferenceType() == EMyReferenceType::generalization ||
+                                                      r.ReferenceType() == EMyReferenceType::composition ||
+                                                      r.ReferenceType() == EMyReferenceType::range; })
+                                  | std::views::transform([](auto const& r) { return r.GetRefTable().Name(); })
+                                  ;
+
+      std::ranges::copy(parents, std::inserter(retval, retval.end()));
+      }
    return retval;
    }
 
 std::set<std::string> TMyTable::GetSuccessors(bool boAll) const {
    std::set<std::string> retval;
-   // seek all part of relationships
-   auto condition = [this](TMyTable const& table) {
-      return std::ranges::any_of(table.References(), [this](TMyReferences const& value) { 
-                    return value.RefTable() == Name() && (value.ReferenceType() == EMyReferenceType::generalization ||
-                                                          value.ReferenceType() == EMyReferenceType::composition ||
-                                                          value.ReferenceType() == EMyReferenceType::range); });
-      };
-
-   auto parents = Dictionary().Tables() | std::views::filter([this](auto const& t) { return t.first != Name(); })
-                                        | std::views::transform([this](auto const& t) -> TMyTable const& { return t.second; })
-                                        | std::views::filter(condition)
-                                        | std::views::transform([](auto const& t)  { return t.Name(); });
-
-   std::ranges::copy(parents, std::inserter(retval, retval.end()));
-   if(boAll) {
-      std::ranges::for_each(parents, [this, &retval](std::string const& tab) {
-            auto succ = Dictionary().FindTable(tab).GetSuccessors(true);
-            std::ranges::copy(succ, std::inserter(retval, retval.end()));
-            });
+   if (boAll) {  // transitive closure of the dictionary, the ids are in the sequence of the names
+      auto const& link = Dictionary().Linkage();
+      for (auto id : Dictionary().Successors(*this)) retval.emplace_hint(retval.end(), link.tables_by_id[id]->Name());
+      }
+   else {  // seek all part of relationships with the reverse index of the dictionary
+      for (auto ref_type : { EMyReferenceType::generalization, EMyReferenceType::composition, EMyReferenceType::range }) {
+         for (auto const& [table, reference] : Dictionary().Referrers(*this, ref_type)) {
+            if (table->Name() != Name()) retval.insert(table->Name());
+            }
+         }
       }
    return retval;
    }
@@ -224,10 +168,10 @@ std::set<std::string> TMyTable::GetSuccessors(bool boAll) const {
 
 
 /// \brief seek all parents of a table to add headers and use the data for processing
-std::vector<TMyTable> TMyTable::GetParents(EMyReferenceType ref_type) const {
+std::vector<std::reference_wrapper<TMyTable const>> TMyTable::GetParents(EMyReferenceType ref_type) const {
    return References() | std::views::filter([&ref_type](auto const& r) { return r.ReferenceType() == ref_type; })
-                       | std::views::transform([this](auto const& r) { return Dictionary().FindTable(r.RefTable()); }) 
-                       | std::ranges::to<std::vector<TMyTable>>();
+                       | std::views::transform([](auto const& r) { return std::cref(r.GetRefTable()); }) 
+                       | std::ranges::to<std::vector>();
    }
 
 
@@ -236,7 +180,7 @@ std::vector<TMyTable::my_part_of_type> TMyTable::GetParent_ofs(EMyReferenceType
    auto parts_ = References() | std::views::filter([&ref_type](auto const& ref) { return ref.ReferenceType() == ref_type;  });
    if(!parts.empty()) {
       for(auto const& ref_part : parts_) {
-         TMyTable const& ref_table = Dictionary().FindTable(ref_part.RefTable());
+         TMyTable const& ref_table = ref_part.GetRefTable();
          //std::string strRefType = 
          }
       }
@@ -248,79 +192,98 @@ std::vector<TMyTable::my_part_of_type> TMyTable::GetParent_ofs(EMyReferenceType
 /// \brief seek all compositions to this table to add header files and data for processing
 /// \details compositions only possible when the primary key of the holding table a part of composed table and in the reference
 std::vector<TMyTable::my_part_of_type> TMyTable::GetPart_ofs(EMyReferenceType ref_type) const {
-   auto filter_refs = [this, ref_type](auto const& r) {
-      return r.RefTable() == Name() && r.ReferenceType() == ref_type;
-      };
-
    std::vector<TMyTable::my_part_of_type> parts;
 
-   for (auto const& [_, ref_table] : Dictionary().Tables() | std::views::filter([this](auto const& t) { return t.first != Name(); })) {
-      auto composed = ref_table.References() | std::views::filter(filter_refs) | std::ranges::to<std::vector>();
-   
-      for(auto & comp_val : composed) {      
-         auto comp_keys = std::views::all(comp_val.Values()) | own::views::first  | std::ranges::to<std::set>();
+   // the reverse index holds the referring tables in the sequence of the tables and their references
+   for (auto const& [ref_table_ptr, comp_ptr] : Dictionary().Referrers(*this, ref_type)) {
+      if (ref_table_ptr->Name() == Name()) continue;
+      auto const& ref_table = *ref_table_ptr;
+      auto const& comp_val = *comp_ptr;
+      auto comp_keys = std::views::all(comp_val.Values()) | own::views::first  | std::ranges::to<std::set>();
  
-         auto filter_prim = [&comp_keys](auto const& attr) { 
-            return attr.Primary() && comp_keys.find(attr.ID()) == comp_keys.end(); 
-            };
-
-         std::string strTypeName;
-         std::transform(ref_table.Name().begin(), ref_table.Name().end(), std::back_inserter(strTypeName), [](char c) { return std::tolower(c); });
-         strTypeName += "_ty";
-         std::string strVarName  = "m_" + ref_table.Name();
-
-         auto prim_keys = ref_table.Attributes() | std::views::filter(filter_prim)
-                                                 | std::views::transform([](auto const& attr) { return attr.ID(); })
-                                                 | std::ranges::to<std::vector<size_t>>();
-         
-         auto swapped = comp_val.Values() | std::views::transform([](const auto& pair) {
-                                                    return std::make_pair(pair.second, pair.first);
-                                                    }) | std::ranges::to<std::vector>();
-
-         parts.emplace_back(std::make_tuple(ref_table, strTypeName, strVarName, prim_keys, swapped));
-         }
+      auto filter_prim = [&comp_keys](auto const& attr) { 
+         return attr.Primary() && comp_keys.find(attr.ID()) == comp_keys.end(); 
+         };
+
+      std::string strTypeName;
+      std::transform(ref_table.Name().begin(), ref_table.Name().end(), std::back_inserter(strTypeName), [](char c) { return std::tolower(c); });
+      strTypeName += "_ty";
+      std::string strVarName  = "m_" + ref_table.Name();
+
+      auto prim_keys = ref_table.Attributes() | std::views::filter(filter_prim)
+                                              | std::views::transform([](auto const& attr) { return attr.ID(); })
+                                              | std::ranges::to<std::vector<size_t>>();
+      
+      auto swapped = comp_val.Values() | std::views::transform([](const auto& pair) {
+                                                 return std::make_pair(pair.second, pair.first);
+                                                 }) | std::ranges::to<std::vector>();
+
+      parts.emplace_back(ref_table, std::move(strTypeName), std::move(strVarName), std::move(prim_keys), std::move(swapped));
       }
    return parts;
    }
 
 /// \brief build a container with pairs of attributes with database informations to this
 std::vector<std::pair<TMyAttribute, TMyDatatype>> TMyTable::GetProcessing_Data() const {
-   return Attributes() | std::views::transform([this](auto const& attr) {
-                             return std::make_pair(attr, Dictionary().FindDataType(attr.DataType())); })
+   return Attributes() | std::views::transform([](auto const& attr) {
+                             return std::make_pair(attr, attr.GetDataType()); })
                        | std::ranges::to<std::vector>();
    }
 
 
+void TMyTable::BuildAttributeIndex() const {
+   auto index = std::make_unique<my_attribute_index>();
+   index->by_name.reserve(Attributes().size());
+
+   // the ids are dense normally, very sparse ids are searched linear
+   size_t max_id = 0;
+   for (auto const& attr : Attributes()) max_id = std::max(max_id, attr.ID());
+   if (auto const iIDs = max_id + 1; iIDs <= 4 * Attributes().size() + 64) index->by_id.assign(iIDs, std::string::npos);
+
+   for (size_t pos = 0; auto const& attr : Attributes()) {
+      index->by_name.emplace(attr.Name(), pos);   // the first attribute wins like with the linear search
+      if (attr.ID() < index->by_id.size() && index->by_id[attr.ID()] == std::string::npos)
+         index->by_id[attr.ID()] = pos;
+      ++pos;
+      }
+
+   attribute_index = std::move(index);
+   }
+
 TMyAttribute const& TMyTable::FindAttribute(std::string const& strName) const {
-   if (auto it = std::find_if(Attributes().begin(), Attributes().end(), [&strName](auto const& attr) {
-      return strName == attr.Name();
-      }); it == Attributes().end()) [[unlikely]] {
-         throw std::runtime_error("Attribute: \""s + strName + "\", in table: \""s + Name() + "\" not found."s);
-         }
-   else return *it;
+   if (attribute_index) [[likely]] {
+      auto const& index = *attribute_index;
+      if (auto it = index.by_name.find(strName); it != index.by_name.end()) [[likely]] return Attributes()[it->second];
+      }
+   else if (auto it = std::ranges::find(Attributes(), strName, &TMyAttribute::Name); it != Attributes().end()) return *it;
+   throw std::runtime_error("Attribute: \""s + strName + "\", in table: \""s + Name() + "\" not found."s);
    }
 
 TMyAttribute const& TMyTable::FindAttribute(size_t iID) const {
-   if (auto it = std::find_if(Attributes().begin(), Attributes().end(), [&iID](auto const& attr) {
-      return iID == attr.ID();
-      }); it == Attributes().end()) [[unlikely]] {
-         throw std::runtime_error("Attribute with ID: "s + /*iID + */ ", in table: \""s + Name() + "\" not found."s);
-         }
-   else return *it;
-}
+   if (attribute_index && !attribute_index->by_id.empty()) [[likely]] {
+      auto const& index = *attribute_index;
+      if (iID < index.by_id.size() && index.by_id[iID] != std::string::npos) [[likely]] return Attributes()[index.by_id[iID]];
+      }
+   else if (auto it = std::find_if(Attributes().begin(), Attributes().end(), [&iID](auto const& attr) {
+                           return iID == attr.ID();
+                           }); it != Attributes().end()) return *it;
+   throw std::runtime_error("Attribute with ID: "s + std::to_string(iID) + ", in table: \""s + Name() + "\" not found."s);
+   }
 
 TMyTable& TMyTable::AddDescription(std::string const& pDescription) {
-   if (Description().size() > 0) Description() += "\n"s;
-   Description() += pDescription;
+   std::get<9>(data) = Dictionary().Texts().Concat(Description(), "\n"sv, pDescription);
    return *this;
    }
 
 TMyTable& TMyTable::AddComment(std::string const& pComment) {
-   if (Comment().size() > 0) Comment() += "\n"s;
-   Comment() += pComment;
+   std::get<10>(data) = Dictionary().Texts().Concat(Comment(), "\n"sv, pComment);
    return *this;
    }
 
+EMyContainerType TMyTable::ContainerType() const {
+   return container_type.value_or(Dictionary().ContainerType());
+   }
+
 
 TMyTable& TMyTable::AddAttribute(int pID, std::string const& pName, std::string const& pDBName, std::string const& pDataType,
                                  size_t pLen, size_t pScale, bool pNotNull, bool pPrimary, std::string const& pCheck, 
@@ -361,13 +324,17 @@ TMyTable& TMyTable::AddAttribute(int pID, std::string const& pName, std::string
 
    Attributes().emplace_back(TMyAttribute(*this, pID, pName, pDBName, pDataType, pLen, pScale, pNotNull, pPrimary, str_check, check_kind, pInit,
                                           str_computed, calc_kind, pDenotation));
+   attribute_index.reset();
+   Dictionary().Unlink();
    return *this;
    }
 
 TMyTable& TMyTable::AddReference(std::string const& pName, EMyReferenceType pRefType, std::string const& pRefTable, 
                                  std::string const& pDescription, std::string const& pCardinality, std::optional<size_t> const& pShowAttribute,
                                  std::string const& pComment, std::vector<std::pair<size_t, size_t>> && pValues) {
-   References().emplace_back(TMyReferences(*this, pName, pRefType, pRefTable, pDescription, pCardinality, pShowAttribute, pComment, std::move(pValues)));
+   References().emplace_back(TMyReferences(*this, pName, pRefType, pRefTable, Dictionary().Texts().Store(pDescription), pCardinality, pShowAttribute,
+                                           Dictionary().Texts().Store(pComment), std::move(pValues)));
+   Dictionary().Unlink();
    return *this;
    }
 
@@ -412,11 +379,14 @@ TMyDatatype& TMyDictionary::AddDataType(std::string const& pDataType, std::strin
                                         std::string const& pCorbaType, std::string const& pCorbaModule,
                                         bool pUseReference, std::string const& pComment) {
    TMyDatatype datatype(*this, pDataType, pDatabaseType, pUseLen, pUseScale, pWithLike, pCheck, pSourceType, pHeader, pPrefix,
-                               pCorbaType, pCorbaModule, pUseReference, pComment);
+                               pCorbaType, pCorbaModule, pUseReference, Texts().Store(pComment));
 
    if (auto [val, success] = datatypes.emplace(pDataType, std::move(datatype)); !success) [[unlikely]]
       throw std::runtime_error("datatype \""s + pDataType + "\" in dictionary \""s + Name() + "\" couldn't inserted."s);
-   else return val->second;
+   else {
+      Unlink();
+      return val->second;
+      }
    }
 
 TMyTable const& TMyDictionary::FindTable(std::string const& strTable) const {
@@ -435,7 +405,135 @@ TMyTable& TMyDictionary::AddTable(std::string const& pName, EMyEntityType pType,
    TMyTable table(*this, pName, pType, pSQLName, pSchema, pSourceName, pNamespace, pSrcPath, pSQLPath, pDenotation);
    auto [val, success] = tables.emplace(myTables::value_type{ pName, std::forward<TMyTable>(table) });
    if (!success) [[unlikely]] throw std::runtime_error("table \""s + pName + "\" couldn't inserted."s);
-   else return val->second;
+   else {
+      Unlink();
+      return val->second;
+      }
+   }
+
+
+namespace {
+   /// \brief bitsets with all nodes reachable with one or more edges for every node
+   /// \details when a node with a smaller id is reached, its closure is complete and added as a whole
+   std::vector<TMyBitset> TransitiveClosure(std::vector<std::vector<TMySymbolTable::symbol_id>> const& edges) {
+      std::vector<TMyBitset> closure(edges.size(), TMyBitset(edges.size()));
+      std::vector<TMySymbolTable::symbol_id> stack;
+      for (size_t start = 0; start < edges.size(); ++start) {
+         auto& reached = closure[start];
+         stack.assign(edges[start].begin(), edges[start].end());
+         while (!stack.empty()) {
+            auto const id = stack.back();
+            stack.pop_back();
+            if (reached.Test(id)) continue;
+            reached.Set(id);
+            if (id < start) reached |= closure[id];
+            else stack.insert(stack.end(), edges[id].begin(), edges[id].end());
+            }
+         }
+      return closure;
+      }
+   }
+
+void TMyDictionary::Link() const {
+   std::lock_guard lock(mtxLinkage);
+   if (boLinked.load(std::memory_order_relaxed)) return;
+
+   auto link = std::make_unique<my_linkage>();
+   link->datatypes_by_id.reserve(datatypes.size());
+   for (auto const& [name, datatype] : datatypes) {
+      link->datatype_names.Intern(name);
+      link->datatypes_by_id.emplace_back(&datatype);
+      }
+
+   link->tables_by_id.reserve(tables.size());
+   for (auto const& [name, table] : tables) {
+      table.iLinkID = link->table_names.Intern(name);
+      link->tables_by_id.emplace_back(&table);
+      table.BuildAttributeIndex();   // built here, so the parallel generators only read it
+      }
+
+   for (auto& index : link->referrers) index.resize(tables.size());
+
+   // unknown names stay unresolved, the access with a search reports the error like before
+   for (auto const& [name, table] : tables) {
+      for (auto const& attr : table.Attributes()) {
+         auto const id = link->datatype_names.Find(attr.DataType());
+         attr.resolved_datatype = id != TMySymbolTable::npos ? link->datatypes_by_id[id] : nullptr;
+         }
+      for (auto const& ref : table.References()) {
+         auto const id = link->table_names.Find(ref.RefTable());
+         ref.resolved_table = id != TMySymbolTable::npos ? link->tables_by_id[id] : nullptr;
+         if (id != TMySymbolTable::npos && static_cast<size_t>(ref.ReferenceType()) < iReferenceTypes) [[likely]]
+            link->referrers[static_cast<size_t>(ref.ReferenceType())][id].emplace_back(my_referrer { &table, &ref });
+         }
+      }
+
+   // dependencies between the tables and their transitive closure
+   link->direct_precursors.resize(tables.size());
+   link->direct_successors.resize(tables.size());
+   for (auto const& [name, table] : tables) {
+      for (auto const& ref : table.References()) {
+         if (ref.resolved_table && (ref.ReferenceType() == EMyReferenceType::generalization ||
+                                    ref.ReferenceType() == EMyReferenceType::composition ||
+                                    ref.ReferenceType() == EMyReferenceType::range)) {
+            link->direct_precursors[table.iLinkID].emplace_back(ref.resolved_table->iLinkID);
+            if (ref.resolved_table->iLinkID != table.iLinkID) link->direct_successors[ref.resolved_table->iLinkID].emplace_back(table.iLinkID);
+            }
+         }
+      }
+   link->precursors = TransitiveClosure(link->direct_precursors);
+   link->successors = TransitiveClosure(link->direct_successors);
+
+   linkage = std::move(link);
+   boLinked.store(true, std::memory_order_release);
+   }
+
+TMySymbolTable::symbol_id TMyDictionary::LinkedID(TMyTable const& table) const {
+   auto const& link = Linkage();
+   if (table.LinkID() >= link.tables_by_id.size() || link.tables_by_id[table.LinkID()]->Name() != table.Name()) [[unlikely]]
+      throw std::runtime_error("table \""s + table.Name() + "\" isn't part of the linked dictionary \""s + Name() + "\"."s);
+   else return table.LinkID();
+   }
+
+std::vector<TMyDictionary::my_referrer> const& TMyDictionary::Referrers(TMyTable const& table, EMyReferenceType ref_type) const {
+   auto const id = LinkedID(table);
+   return linkage->referrers[static_cast<size_t>(ref_type)][id];
+   }
+
+TMyBitset const& TMyDictionary::Precursors(TMyTable const& table) const {
+   auto const id = LinkedID(table);
+   return linkage->precursors[id];
+   }
+
+TMyBitset const& TMyDictionary::Successors(TMyTable const& table) const {
+   auto const id = LinkedID(table);
+   return linkage->successors[id];
+   }
+
+bool TMyDictionary::IsPrecursor(TMyTable const& precursor, TMyTable const& table) const {
+   auto const id = LinkedID(precursor);
+   return Precursors(table).Test(id);
+   }
+
+void TMyDictionary::Unlink() const {
+   std::lock_guard lock(mtxLinkage);
+   boLinked.store(false, std::memory_order_release);
+   if (linkage) {
+      // the ids and pointers belong to the released link step, without them the accessors search again until the next Link()
+      for (auto const& [name, table] : tables) {
+         table.iLinkID = TMySymbolTable::npos;
+         table.attribute_index.reset();
+         for (auto const& attr : table.Attributes()) attr.resolved_datatype = nullptr;
+         for (auto const& ref : table.References()) ref.resolved_table = nullptr;
+         }
+      linkage.reset();
+      }
+   buildSQLRef.ClearStatements();
+   }
+
+TMyDictionary::my_linkage const& TMyDictionary::Linkage() const {
+   if (!IsLinked()) [[unlikely]] Link();
+   return *linkage;
    }
 
 TMyNameSpace& TMyDictionary::FindNameSpace(std::string const& pName) {
@@ -503,23 +601,23 @@ void TMyDictionary::CreateClass(std::string const& strTable, std::ostream& out)
 
 
 void  TMyDictionary::Create_All(std::ostream& out, std::ostream& err) const {
-   using job_type = std::pair<std::string, std::function<Generator_SQL const&(std::ostream&)>>;
-   static std::vector<job_type> jobs = {
-      /*
-      * using job_type = std::pair<std::string, std::function<bool (std::ostream&)>>;
-      job_type { "create_tables.sql"s,      std::bind(&TMyDictionary::Create_SQL_Tables, this, std::placeholders::_1) },
-      job_type { "create_additinals.sql"s,  std::bind(&TMyDictionary::Create_SQL_Additionals, this, std::placeholders::_1) },
-      job_type { "create_rangevalues.sql"s, std::bind(&TMyDictionary::Create_SQL_RangeValues, this, std::placeholders::_1) },
-      job_type { "drop_all.sql"s,           std::bind(&TMyDictionary::SQL_Drop_Tables, this, std::placeholders::_1) },
-      job_type { "add_documentation.sql"s,  std::bind(&TMyDictionary::Create_SQL_Documentation, this, std::placeholders::_1) }
-      */
-      job_type { "create_tables.sql"s,      std::bind(&Generator_SQL::WriteSQLTables, &this->sql_builder(), std::placeholders::_1) },
-      job_type { "create_additinals.sql"s,  std::bind(&Generator_SQL::WriteSQLAdditionals, &this->sql_builder(), std::placeholders::_1) },
-      job_type { "create_rangevalues.sql"s, std::bind(&Generator_SQL::WriteSQLRangeValues, &this->sql_builder(), std::placeholders::_1) },
-      job_type { "drop_all.sql"s,           std::bind(&Generator_SQL::WriteSQLDropTables, &this->sql_builder(), std::placeholders::_1) },
-      job_type { "add_documentation.sql"s,  std::bind(&Generator_SQL::WriteSQLDocumentation, &this->sql_builder(), std::placeholders::_1) }
+   try {
+      TMyOutputWriter writer(ManifestFile());
+      Create_All(writer, out, err);
+      }
+   catch(std::exception& ex) {
+      err << ex.what() << '\n';
+      }
+   }
+
+void  TMyDictionary::Create_All(TMyOutputBackend& output, std::ostream& out, std::ostream& err) const {
+   Create_Selected(output, my_artifacts { }, out, err);
+   }
+
+void  TMyDictionary::Create_Selected(TMyOutputBackend& output, my_artifacts const& artifacts, std::ostream& out, std::ostream& err) const {
+   using job_id     = TMyJobScheduler::job_id;
+   using write_func = std::function<void (std::ostream&)>;
 
-      };
    try {
       out << "Dictionary:  " << Name() << '\n'
           << "Identifier:  " << Identifier() << '\n'
@@ -535,169 +633,215 @@ void  TMyDictionary::Create_All(std::ostream& out, std::ostream& err) const {
        
       out << "-----------------------------------------------------------------------------\n";
 
-      fs::path sqlPath = SQLPath();
-      fs::create_directories(sqlPath);
-      out << "create sql files in directory: " << sqlPath.string() << '\n';
+      // measurement of the jobs only when requested, without instrumentation the timers do nothing
+      std::unique_ptr<TMyInstrumentation> instrumentation;
+      if (Timings() || !TraceFile().empty()) instrumentation = std::make_unique<TMyInstrumentation>();
+      TMyInstrumentation* timings = instrumentation.get();
 
-      for(auto const& [filename, funct] : jobs) {
-         auto fileName = sqlPath / filename;
-         std::ofstream of_sql(fileName);
-         funct(of_sql);
-         of_sql.close();
-         convertToUTF8WithBOM(fileName);
+      {
+         TMyScopedTimer timer(timings, "link dictionary", "link");
+         Link();
          }
 
-      // create the general documentation page with all informations
-      fs::path doxPath = DocPath();
-      fs::create_directories(doxPath);
-      out << "create documentation files in directory: " << doxPath.string() << '\n';
-      auto fileName = doxPath / (Identifier() + ".dox"s);
-      std::ofstream of_dox(fileName);
-      Create_Doxygen(of_dox);
-      of_dox.close();
-      convertToUTF8WithBOM(fileName);
-
-      fs::create_directories(doxPath / "sql");
-      fileName = doxPath / "sql" / (Identifier() + "_sql.dox"s);
-      of_dox.open(fileName);
-      Create_Doxygen_SQL(of_dox);
-      of_dox.close();
-      convertToUTF8WithBOM(fileName);
-
-
-      fs::create_directories(SourcePath());
-      fs::create_directories(DocPath());
-
-      out << "\ncreate source files in directory: " << SourcePath().string() << '\n';
-
-      // 
-
-      auto srcBasePath = SourcePath() / PathToBase();
-      fs::create_directories(srcBasePath);
-      auto srcBaseDefinitionFile = srcBasePath / "BaseDefinitions.h"s;
-      std::ofstream of_base_definitions(srcBaseDefinitionFile);
-      if (of_base_definitions) {
-         CreateBaseDefintionFile(of_base_definitions);
-         of_base_definitions.close();
-         convertToUTF8WithBOM(srcBaseDefinitionFile);
+      TMyJobScheduler scheduler(Threads());
+
+      // messages for the console, written after all jobs are finished in the sequence of the definition,
+      // when jobs are assigned to a message it ends with the state of these jobs
+      std::vector<std::pair<std::string, std::vector<job_id>>> protocol;
+
+      // every directory is created once by an own job, the file jobs depend on the job for their directory
+      std::map<fs::path, job_id> directories;
+      auto directory = [&scheduler, &directories, &output, timings](fs::path const& path) -> job_id {
+         if (auto it = directories.find(path); it != directories.end()) return it->second;
+         auto id = scheduler.Add("create directory "s + path.string(), [&output, path, timings]() {
+                        TMyScopedTimer timer(timings, path.string(), "directory");
+                        output.CreateDirectories(path);
+                        });
+         directories.emplace(path, id);
+         return id;
+         };
+
+      // the content is rendered in memory into a chunked text buffer, converted to UTF-8 with BOM while the generator writes,
+      // the output backend decides about the write, the writer for the filesystem touches only files with changed content.
+      // the jobs are measured in the phase which is set before they are added, the rendering with the conversion
+      // to UTF-8 separated from the write
+      std::string_view phase = "sql";
+      auto file = [&scheduler, &directory, &output, &phase, timings](fs::path const& fileName, write_func&& func, bool boUTF8 = true, 
+                                                                      std::vector<job_id> depends = { }) -> job_id {
+         depends.emplace_back(directory(fileName.parent_path()));
+         return scheduler.Add(fileName.string(), [&output, fileName, func = std::move(func), boUTF8, phase, timings]() {
+                  if (boUTF8) {
+                     TMyUTF8Stream os(timings != nullptr);
+                     TMyTextBuffer const* content = nullptr;
+                     {
+                        TMyScopedTimer timer(timings, fileName.string(), phase);
+                        func(os);
+                        content = &os.Finish();
+                        timer.Bytes(content->Size());
+                        timer.Conversion(os.Conversion());
+                        }
+                     TMyScopedTimer timer(timings, fileName.string(), "write");
+                     timer.Bytes(content->Size());
+                     output.Write(fileName, *content);
+                     }
+                  else {
+                     TMyTextStream os;
+                     {
+                        TMyScopedTimer timer(timings, fileName.string(), phase);
+                        func(os);
+                        timer.Bytes(os.Text().Size());
+                        }
+                     TMyScopedTimer timer(timings, fileName.string(), "write");
+                     timer.Bytes(os.Text().Size());
+                     output.Write(fileName, os.Text());
+                     }
+                  }, depends);
+         };
+
+      // the sql statements of every table are rendered once into the cache of the sql builder, parallel for the tables,
+      // the files with statements of all tables wait for this and use the statements from the cache
+      // only the files with all tables use the statements, with a selection of tables the cache holds the others already
+      std::vector<job_id> statements;
+      if (artifacts.boModelFiles) {
+         for (auto const& [name, table] : Tables()) {
+            if (artifacts.tables && !artifacts.tables->contains(name)) continue;
+            statements.emplace_back(scheduler.Add("prepare sql statements for "s + name, [this, &table, &name, timings]() {
+                                           TMyScopedTimer timer(timings, name, "prepare");
+                                           sql_builder().PrepareStatements(table);
+                                           }));
+            }
+
+         // ------- sql scripts for the complete project -------------------------
+         fs::path sqlPath = SQLPath();
+         protocol.push_back({ "create sql files in directory: "s + sqlPath.string() + "\n"s, { } });
+         file(sqlPath / "create_tables.sql"s,      [this](std::ostream& os) { sql_builder().WriteSQLTables(os); }, true, statements);
+         file(sqlPath / "create_additinals.sql"s,  [this](std::ostream& os) { sql_builder().WriteSQLAdditionals(os); }, true, statements);
+         file(sqlPath / "create_rangevalues.sql"s, [this](std::ostream& os) { sql_builder().WriteSQLRangeValues(os); }, true, statements);
+         file(sqlPath / "drop_all.sql"s,           [this](std::ostream& os) { sql_builder().WriteSQLDropTables(os); }, true, statements);
+         file(sqlPath / "add_documentation.sql"s,  [this](std::ostream& os) { sql_builder().WriteSQLDocumentation(os); });
+
+         // create the general documentation page with all informations
+         phase = "dox";
+         fs::path doxPath = DocPath();
+         protocol.push_back({ "create documentation files in directory: "s + doxPath.string() + "\n"s, { } });
+         file(doxPath / (Identifier() + ".dox"s), [this](std::ostream& os) { Create_Doxygen(os); });
+         file(doxPath / "sql" / (Identifier() + "_sql.dox"s), [this](std::ostream& os) { Create_Doxygen_SQL(os); }, true, statements);
          }
 
-      // ---------create base header when used ----------------------------
-      if(UseBaseClass()) {
-         auto srcBaseClassFile = srcBasePath / "BaseClass.h"s;
-         std::ofstream of_base(srcBaseClassFile);
-         if(of_base) {
-            CreateBaseHeader(of_base);
-            of_base.close();
-            convertToUTF8WithBOM(srcBaseClassFile);
+      directory(SourcePath());
+      directory(DocPath());
+
+      phase = "source";
+      protocol.push_back({ "\ncreate source files in directory: "s + SourcePath().string() + "\n"s, { } });
+
+      if (artifacts.boProjectFiles) {
+         auto srcBasePath = SourcePath() / PathToBase();
+         file(srcBasePath / "BaseDefinitions.h"s, [this](std::ostream& os) { CreateBaseDefintionFile(os); });
+
+         // ---------create base header when used ----------------------------
+         if(UseBaseClass()) {
+            file(srcBasePath / "BaseClass.h"s, [this](std::ostream& os) { CreateBaseHeader(os); });
             }
          }
  
-      // ---- create header and source files for tables -------------------
+      // ---- create header and source files for tables, every file is an own job -------------------
       for (auto const& [name, table] : Tables()) {
+         if (artifacts.tables && !artifacts.tables->contains(name)) continue;
          auto srcPath = SourcePath() / table.SrcPath();
-         fs::create_directories(srcPath);
-         out << "files for table " << name << " ... ";
-         auto fileName = srcPath / (name + ".h"s);
-         std::ofstream of_src(fileName);
-         table.CreateHeader(of_src);
-         of_src.close();
-         convertToUTF8WithBOM(fileName);
-
-         fileName = srcPath / (name + ".cpp"s);
-         of_src.open(fileName);
-         table.CreateSource(of_src);
-         of_src.close();
-         convertToUTF8WithBOM(fileName);
-
          auto doxPath = DocPath() / table.SrcPath();
-         fs::create_directories(doxPath);
-         fileName = doxPath / (name + ".dox"s);
-         std::ofstream of_dox(fileName);
-         table.CreateDox(of_dox);
-         of_dox.close();
-         convertToUTF8WithBOM(fileName);
-         out << "done.\n";
+         std::vector<job_id> jobs;
+         phase = "header";
+         jobs.emplace_back(file(srcPath / (name + ".h"s),   [&table](std::ostream& os) { table.CreateHeader(os); }));
+         phase = "source";
+         jobs.emplace_back(file(srcPath / (name + ".cpp"s), [&table](std::ostream& os) { table.CreateSource(os); }));
+         phase = "dox";
+         jobs.emplace_back(file(doxPath / (name + ".dox"s), [&table](std::ostream& os) { table.CreateDox(os); }));
+         protocol.push_back({ "files for table "s + name + " ... "s, std::move(jobs) });
          }
 
       // ------- generate code for the persistence layer -------------------------
       //  only when a class name for the persistence layer defined before
       // -------------------------------------------------------------------------
-      if(HasPersistenceClass()) {
+      if(artifacts.boModelFiles && HasPersistenceClass()) {
          auto PathToPers = [this]() {
             if (PathToPersistence().root_path() == fs::path()) return SourcePath() / PathToPersistence();
             else return PathToPersistence();
             }();
-         // create directories to the folder with the persistence layer files
-         fs::create_directories(PathToPers);
-         out << "\ncreate reader files in directory: " << PathToPers.string() << '\n';
-
-         auto fileName = PathToPers / (PersistenceName() + "_sql.h"s);
-         std::ofstream of_db(fileName);
-         if (of_db) CreateSQLStatementHeader(of_db);
-         of_db.close();
-         convertToUTF8WithBOM(fileName);
-
-         fileName = PathToPers / (PersistenceName() + "_sql.cpp"s);
-         of_db.open(fileName);
-         if (of_db) CreateSQLStatementSource(of_db);
-         of_db.close();
-         convertToUTF8WithBOM(fileName);
-
-         fileName = PathToPers / (PersistenceName() + ".h"s);
-         of_db.open(fileName);
-         if (of_db) CreateReaderHeader(of_db);
-         of_db.close();
-         convertToUTF8WithBOM(fileName);
-
-         fileName = PathToPers / (PersistenceName() + ".cpp"s);
-         of_db.open(fileName);
-         if (of_db) CreateReaderSource(of_db);
-         of_db.close();
-         convertToUTF8WithBOM(fileName);
+         phase = "reader";
+         protocol.push_back({ "\ncreate reader files in directory: "s + PathToPers.string() + "\n"s, { } });
+
+         file(PathToPers / (PersistenceName() + "_sql.h"s),   [this](std::ostream& os) { CreateSQLStatementHeader(os); });
+         file(PathToPers / (PersistenceName() + "_sql.cpp"s), [this](std::ostream& os) { CreateSQLStatementSource(os); }, true, statements);
+         file(PathToPers / (PersistenceName() + ".h"s),       [this](std::ostream& os) { CreateReaderHeader(os); });
+         file(PathToPers / (PersistenceName() + ".cpp"s),     [this](std::ostream& os) { CreateReaderSource(os); });
          }
 
       if(boWithCorba) {  // eventuell spter ber if steuern
-         auto idlBasicPath = IDLPath() / "Basic.idl";
-         out << "\ncreate basic corba idl file: " << idlBasicPath.string();
-         fs::create_directories(idlBasicPath.parent_path());
-         std::ofstream of_base(idlBasicPath);
-         CreateBasicCorbaIDL(of_base);
-         of_base.close();
-         // convertToUTF8WithBOM(idlBasicPath);
-
-         auto corbaIDL = IDLPath() / (Identifier() + ".idl"s);
-         out << "\ncreate corba idl file: " << corbaIDL.string();
-         of_base.open(corbaIDL);
-         CreateCorbaIDL(of_base);
-         of_base.close();
-         // convertToUTF8WithBOM(corbaIDL);
-
-         auto corbaBasisPath = CorbaPath() / "Basic_impl.h";
-         out << "\ncreate corba implementationfile for basic module: " << corbaBasisPath.string();
-         fs::create_directories(corbaBasisPath.parent_path());
-         of_base.open(corbaBasisPath);
-         CreateBasicCorbaHeader(of_base);
-         of_base.close();
-         convertToUTF8WithBOM(corbaBasisPath);
-
-         std::string strHeader = Identifier() + "_Impl.h"s;
-         auto corbaImplHeader = CorbaPath() / strHeader;
-         out << "\ncreate corba header file for implementation the corba servlet: " << corbaImplHeader.string();
-         of_base.open(corbaImplHeader);
-         CreateCorbaImplementationHeader(of_base);
-         of_base.close();
-         convertToUTF8WithBOM(corbaImplHeader);
-
-         auto corbaImplSource = CorbaPath() / (Identifier() + "_Impl.cpp"s);
-         out << "\ncreate corba header file for implementation the corba servlet: " << corbaImplSource.string();
-         of_base.open(corbaImplSource);
-         CreateCorbaImplementationSource(of_base, strHeader);
-         of_base.close();
-         convertToUTF8WithBOM(corbaImplSource);
+         phase = "corba";
+         if (artifacts.boProjectFiles) {
+            auto idlBasicPath = IDLPath() / "Basic.idl";
+            protocol.push_back({ "\ncreate basic corba idl file: "s + idlBasicPath.string(), { } });
+            file(idlBasicPath, [this](std::ostream& os) { CreateBasicCorbaIDL(os); }, false);
+
+            auto corbaBasisPath = CorbaPath() / "Basic_impl.h";
+            protocol.push_back({ "\ncreate corba implementationfile for basic module: "s + corbaBasisPath.string(), { } });
+            file(corbaBasisPath, [this](std::ostream& os) { CreateBasicCorbaHeader(os); });
+            }
+
+         if (artifacts.boModelFiles) {
+            auto corbaIDL = IDLPath() / (Identifier() + ".idl"s);
+            protocol.push_back({ "\ncreate corba idl file: "s + corbaIDL.string(), { } });
+            file(corbaIDL, [this](std::ostream& os) { CreateCorbaIDL(os); }, false);
+
+            std::string strHeader = Identifier() + "_Impl.h"s;
+            auto corbaImplHeader = CorbaPath() / strHeader;
+            protocol.push_back({ "\ncreate corba header file for implementation the corba servlet: "s + corbaImplHeader.string(), { } });
+            file(corbaImplHeader, [this](std::ostream& os) { CreateCorbaImplementationHeader(os); });
 
+            auto corbaImplSource = CorbaPath() / (Identifier() + "_Impl.cpp"s);
+            protocol.push_back({ "\ncreate corba header file for implementation the corba servlet: "s + corbaImplSource.string(), { } });
+            file(corbaImplSource, [this, strHeader](std::ostream& os) { CreateCorbaImplementationSource(os, strHeader); });
+            }
+         }
+
+      scheduler.Run();
+      {
+         TMyScopedTimer timer(timings, "save output", "save");
+         output.Save();
+         }
+
+      for (auto const& [message, jobs] : protocol) {
+         out << message;
+         if (jobs.size() > 0) {
+            out << (std::ranges::any_of(jobs, [&scheduler](job_id id) { return scheduler.Failed(id); }) ? "failed.\n" : "done.\n");
+            }
+         }
+      out_format(out, "\nfiles written: {}, unchanged: {}\n", output.Written(), output.Unchanged());
+
+      if (instrumentation) {
+         if (Timings()) instrumentation->WriteSummary(out);
+         if (!TraceFile().empty()) {
+            instrumentation->WriteChromeTrace(TraceFile());
+            out << "trace with " << instrumentation->Size() << " events written to " << TraceFile().string() << '\n';
+            }
          }
 
+      // report every error once, successors of a failed job share the exception of the failed job
+      std::vector<std::exception_ptr> errors;
+      for (job_id id = 0; id < scheduler.Size(); ++id) {
+         if (auto error = scheduler.Error(id); error && std::ranges::find(errors, error) == errors.end()) {
+            errors.emplace_back(error);
+            try {
+               std::rethrow_exception(error);
+               }
+            catch (std::exception& ex) {
+               err << scheduler.Name(id) << ": " << ex.what() << '\n';
+               }
+            catch (...) {
+               err << scheduler.Name(id) << ": unknown error\n";
+               }
+            }
+         }
       }
    catch(std::exception& ex) {
       err << ex.what() << '\n';
@@ -712,9 +856,17 @@ bool TMyDictionary::CreateBaseDefintionFile(std::ostream& out) const {
       "#include <map>"s,
       "#include <vector>"s,
       "#include <set>"s,
-      //"#include <array>"s,
-      //"#include <span>"s,
+      "#include <array>"s,
+      "#include <span>"s,
       "#include <utility>"s,
+      "#include <tuple>"s,
+      "#include <algorithm>"s,
+      "#include <functional>"s,
+      "#include <stdexcept>"s,
+      "#include <iterator>"s,
+      "#include <bit>"s,
+      "#include <cstdint>"s,
+      "#include <cstddef>"s,
       "#include <ranges>"
       ""s,
       "namespace own {",
@@ -779,6 +931,17 @@ bool TMyDictionary::CreateBaseDefintionFile(std::ostream& out) const {
       "   constexpr bool is_map_v = is_map<ty>::value;"s,
       ""s,
       "   // ----------------------------------------------------------------------------"s,
+      "   // column containers (columns_ty) of the data classes are detected with the row_view"s,
+      "   template <typename ty, typename = void>"s,
+      "   struct is_columns : std::false_type {};"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   struct is_columns<ty, std::void_t<typename ty::row_view>> : std::true_type {};"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   constexpr bool is_columns_v = is_columns<ty>::value;"s,
+      ""s,
+      "   // ----------------------------------------------------------------------------"s,
       "   template <typename ty>"s,
       "   concept always_false = false;"s,
       ""s,
@@ -802,6 +965,11 @@ bool TMyDictionary::CreateBaseDefintionFile(std::ostream& out) const {
       "      };"s,
       ""s,
       "   template <typename ty>"s,
+      "   struct used_type_for_container<ty, std::enable_if_t<is_columns<ty>::value>> {"s,
+      "      using type = typename ty::value_type;"s,
+      "      };"s,
+      ""s,
+      "   template <typename ty>"s,
       "   using used_type_t = typename used_type_for_container<ty>::type;"s,
       ""s,
       "   // ----------------------------------------------------------------------------"s,
@@ -834,6 +1002,280 @@ bool TMyDictionary::CreateBaseDefintionFile(std::ostream& out) const {
       "      inline constexpr auto second = second_view{};"s,
       "      }"s,
       ""s,
+      "   // ----------------------------------------------------------------------------"s,
+      "   // sorted map in one vector for read mostly data (container_ty with EMyContainerType::flat_map)"s,
+      "   // - lookups with a binary search over contiguous memory, one allocation for all elements"s,
+      "   // - insert and emplace move the following elements, bulk loads use insert_bulk with one sort"s,
+      "   // - the key is stored without const, it mustn't be changed through the iterators"s,
+      "   // - key_ty and value_ty must be copy and move assignable, the primary_key of the data classes defines both"s,
+      "   template <typename key_ty, typename value_ty, typename compare_ty = std::less<key_ty>>"s,
+      "   class flat_map {"s,
+      "      public:"s,
+      "         using key_type       = key_ty;"s,
+      "         using mapped_type    = value_ty;"s,
+      "         using value_type     = std::pair<key_ty, value_ty>;"s,
+      "         using key_compare    = compare_ty;"s,
+      "         using container_type = std::vector<value_type>;"s,
+      "         using iterator       = typename container_type::iterator;"s,
+      "         using const_iterator = typename container_type::const_iterator;"s,
+      "         using size_type      = typename container_type::size_type;"s,
+      ""s,
+      "      private:"s,
+      "         container_type values;"s,
+      "         compare_ty     comp;"s,
+      ""s,
+      "      public:"s,
+      "         flat_map() = default;"s,
+      "         explicit flat_map(container_type&& data) { insert_bulk(std::move(data)); }"s,
+      ""s,
+      "         iterator       begin() { return values.begin(); }"s,
+      "         iterator       end() { return values.end(); }"s,
+      "         const_iterator begin() const { return values.begin(); }"s,
+      "         const_iterator end() const { return values.end(); }"s,
+      "         size_type      size() const { return values.size(); }"s,
+      "         bool           empty() const { return values.empty(); }"s,
+      "         void           clear() { values.clear(); }"s,
+      "         void           reserve(size_type count) { values.reserve(count); }"s,
+      ""s,
+      "         iterator lower_bound(key_ty const& key) { return std::ranges::lower_bound(values, key, comp, &value_type::first); }"s,
+      "         const_iterator lower_bound(key_ty const& key) const { return std::ranges::lower_bound(values, key, comp, &value_type::first); }"s,
+      ""s,
+      "         iterator find(key_ty const& key) {"s,
+      "            auto it = lower_bound(key);"s,
+      "            return it != values.end() && !comp(key, it->first) ? it : values.end();"s,
+      "            }"s,
+      ""s,
+      "         const_iterator find(key_ty const& key) const {"s,
+      "            auto it = lower_bound(key);"s,
+      "            return it != values.end() && !comp(key, it->first) ? it : values.end();"s,
+      "            }"s,
+      ""s,
+      "         bool      contains(key_ty const& key) const { return find(key) != values.end(); }"s,
+      "         size_type count(key_ty const& key) const { return contains(key) ? 1 : 0; }"s,
+      ""s,
+      "         value_ty& at(key_ty const& key) {"s,
+      "            if (auto it = find(key); it != values.end()) [[likely]] return it->second;"s,
+      "            else throw std::out_of_range(\"key not found in flat_map\");"s,
+      "            }"s,
+      ""s,
+      "         value_ty const& at(key_ty const& key) const {"s,
+      "            if (auto it = find(key); it != values.end()) [[likely]] return it->second;"s,
+      "            else throw std::out_of_range(\"key not found in flat_map\");"s,
+      "            }"s,
+      ""s,
+      "         value_ty& operator [] (key_ty const& key) { return try_emplace(key).first->second; }"s,
+      ""s,
+      "         template <typename... args_ty>"s,
+      "         std::pair<iterator, bool> try_emplace(key_ty const& key, args_ty&&... args) {"s,
+      "            auto it = lower_bound(key);"s,
+      "            if (it != values.end() && !comp(key, it->first)) return { it, false };"s,
+      "            return { values.emplace(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<args_ty>(args)...)), true };"s,
+      "            }"s,
+      ""s,
+      "         template <typename... args_ty>"s,
+      "         std::pair<iterator, bool> emplace(args_ty&&... args) {"s,
+      "            value_type value(std::forward<args_ty>(args)...);"s,
+      "            auto it = lower_bound(value.first);"s,
+      "            if (it != values.end() && !comp(value.first, it->first)) return { it, false };"s,
+      "            return { values.insert(it, std::move(value)), true };"s,
+      "            }"s,
+      ""s,
+      "         std::pair<iterator, bool> insert(value_type const& value) { return emplace(value); }"s,
+      ""s,
+      "         iterator  erase(const_iterator pos) { return values.erase(pos); }"s,
+      "         size_type erase(key_ty const& key) {"s,
+      "            if (auto it = find(key); it != values.end()) { values.erase(it); return 1; }"s,
+      "            else return 0;"s,
+      "            }"s,
+      ""s,
+      "         // append all elements and sort once, elements with a key already in the map are ignored like with insert"s,
+      "         void insert_bulk(container_type&& data) {"s,
+      "            auto const count = values.size();"s,
+      "            values.insert(values.end(), std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));"s,
+      "            auto middle = values.begin() + count;"s,
+      "            std::ranges::stable_sort(middle, values.end(), comp, &value_type::first);"s,
+      "            std::ranges::inplace_merge(values, middle, comp, &value_type::first);"s,
+      "            auto duplicates = std::ranges::unique(values, [this](key_ty const& lhs, key_ty const& rhs) { return !comp(lhs, rhs) && !comp(rhs, lhs); },"s,
+      "                                                  &value_type::first);"s,
+      "            values.erase(duplicates.begin(), duplicates.end());"s,
+      "            }"s,
+      "      };"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   struct is_flat_map : std::false_type {};"s,
+      ""s,
+      "   template <typename key_ty, typename value_ty, typename compare_ty>"s,
+      "   struct is_flat_map<flat_map<key_ty, value_ty, compare_ty>> : std::true_type {};"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   constexpr bool is_flat_map_v = is_flat_map<ty>::value;"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   struct used_type_for_container<ty, std::enable_if_t<is_flat_map<ty>::value>> {"s,
+      "      using type = typename ty::mapped_type;"s,
+      "      };"s,
+      ""s,
+      "   // ----------------------------------------------------------------------------"s,
+      "   // hash map with open addressing for point lookups in memory (hash_container_ty of the data classes)"s,
+      "   // - the elements are stored in one vector, the slots hold the positions of the elements in this vector"s,
+      "   // - linear probing over a power of two slots, the hash is spread with a fibonacci multiplication"s,
+      "   // - erase shifts the following slots back (no tombstones) and moves the last element into the gap"s,
+      "   // - value_type must be move assignable for erase, the primary_key of the data classes defines the assignments"s,
+      "   template <typename key_ty, typename value_ty, typename hash_ty = std::hash<key_ty>, typename equal_ty = std::equal_to<key_ty>>"s,
+      "   class hash_map {"s,
+      "      public:"s,
+      "         using key_type       = key_ty;"s,
+      "         using mapped_type    = value_ty;"s,
+      "         using value_type     = std::pair<key_ty, value_ty>;"s,
+      "         using hasher         = hash_ty;"s,
+      "         using key_equal      = equal_ty;"s,
+      "         using container_type = std::vector<value_type>;"s,
+      "         using iterator       = typename container_type::iterator;"s,
+      "         using const_iterator = typename container_type::const_iterator;"s,
+      "         using size_type      = typename container_type::size_type;"s,
+      ""s,
+      "      private:"s,
+      "         static constexpr std::size_t empty_slot = static_cast<std::size_t>(-1);"s,
+      ""s,
+      "         container_type           values;"s,
+      "         std::vector<std::size_t> slots;        // position of the element in values or empty_slot"s,
+      "         int                      shift = 0;    // 64 - log2 of the count of slots"s,
+      "         hash_ty                  hash;"s,
+      "         equal_ty                 equal;"s,
+      ""s,
+      "         std::size_t home(key_ty const& key) const {"s,
+      "            return static_cast<std::size_t>((static_cast<std::uint64_t>(hash(key)) * 0x9e3779b97f4a7c15ull) >> shift);"s,
+      "            }"s,
+      ""s,
+      "         std::size_t next(std::size_t slot) const { return (slot + 1) & (slots.size() - 1); }"s,
+      ""s,
+      "         // slot with the key or the empty slot where the key belongs, slots mustn't be empty"s,
+      "         std::size_t lookup(key_ty const& key) const {"s,
+      "            auto slot = home(key);"s,
+      "            while (slots[slot] != empty_slot && !equal(values[slots[slot]].first, key)) slot = next(slot);"s,
+      "            return slot;"s,
+      "            }"s,
+      ""s,
+      "         // enough slots for count elements with a load factor of 3/4"s,
+      "         void grow(std::size_t count) {"s,
+      "            if (count * 4 <= slots.size() * 3) return;"s,
+      "            std::size_t size = slots.empty() ? 16 : slots.size() * 2;"s,
+      "            while (count * 4 > size * 3) size *= 2;"s,
+      "            slots.assign(size, empty_slot);"s,
+      "            shift = 64 - std::countr_zero(size);"s,
+      "            for (std::size_t pos = 0; pos < values.size(); ++pos) {"s,
+      "               auto slot = home(values[pos].first);"s,
+      "               while (slots[slot] != empty_slot) slot = next(slot);"s,
+      "               slots[slot] = pos;"s,
+      "               }"s,
+      "            }"s,
+      ""s,
+      "      public:"s,
+      "         hash_map() = default;"s,
+      ""s,
+      "         iterator       begin() { return values.begin(); }"s,
+      "         iterator       end() { return values.end(); }"s,
+      "         const_iterator begin() const { return values.begin(); }"s,
+      "         const_iterator end() const { return values.end(); }"s,
+      "         size_type      size() const { return values.size(); }"s,
+      "         bool           empty() const { return values.empty(); }"s,
+      "         void           clear() { values.clear(); slots.clear(); }"s,
+      "         void           reserve(size_type count) { values.reserve(count); grow(count); }"s,
+      ""s,
+      "         iterator find(key_ty const& key) {"s,
+      "            if (slots.empty()) return values.end();"s,
+      "            auto slot = lookup(key);"s,
+      "            return slots[slot] != empty_slot ? values.begin() + slots[slot] : values.end();"s,
+      "            }"s,
+      ""s,
+      "         const_iterator find(key_ty const& key) const {"s,
+      "            if (slots.empty()) return values.end();"s,
+      "            auto slot = lookup(key);"s,
+      "            return slots[slot] != empty_slot ? values.begin() + slots[slot] : values.end();"s,
+      "            }"s,
+      ""s,
+      "         bool      contains(key_ty const& key) const { return find(key) != values.end(); }"s,
+      "         size_type count(key_ty const& key) const { return contains(key) ? 1 : 0; }"s,
+      ""s,
+      "         value_ty& at(key_ty const& key) {"s,
+      "            if (auto it = find(key); it != values.end()) [[likely]] return it->second;"s,
+      "            else throw std::out_of_range(\"key not found in hash_map\");"s,
+      "            }"s,
+      ""s,
+      "         value_ty const& at(key_ty const& key) const {"s,
+      "            if (auto it = find(key); it != values.end()) [[likely]] return it->second;"s,
+      "            else throw std::out_of_range(\"key not found in hash_map\");"s,
+      "            }"s,
+      ""s,
+      "         value_ty& operator [] (key_ty const& key) { return try_emplace(key).first->second; }"s,
+      ""s,
+      "         template <typename... args_ty>"s,
+      "         std::pair<iterator, bool> try_emplace(key_ty const& key, args_ty&&... args) {"s,
+      "            grow(values.size() + 1);"s,
+      "            auto slot = lookup(key);"s,
+      "            if (slots[slot] != empty_slot) return { values.begin() + slots[slot], false };"s,
+      "            values.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<args_ty>(args)...));"s,
+      "            slots[slot] = values.size() - 1;"s,
+      "            return { std::prev(values.end()), true };"s,
+      "            }"s,
+      ""s,
+      "         template <typename... args_ty>"s,
+      "         std::pair<iterator, bool> emplace(args_ty&&... args) {"s,
+      "            value_type value(std::forward<args_ty>(args)...);"s,
+      "            grow(values.size() + 1);"s,
+      "            auto slot = lookup(value.first);"s,
+      "            if (slots[slot] != empty_slot) return { values.begin() + slots[slot], false };"s,
+      "            values.emplace_back(std::move(value));"s,
+      "            slots[slot] = values.size() - 1;"s,
+      "            return { std::prev(values.end()), true };"s,
+      "            }"s,
+      ""s,
+      "         std::pair<iterator, bool> insert(value_type const& value) { return emplace(value); }"s,
+      ""s,
+      "         size_type erase(key_ty const& key) {"s,
+      "            if (slots.empty()) return 0;"s,
+      "            auto gap = lookup(key);"s,
+      "            if (slots[gap] == empty_slot) return 0;"s,
+      "            auto const pos = slots[gap];"s,
+      "            // elements behind the gap move back when their home slot isn't between the gap and their slot"s,
+      "            for (auto slot = next(gap); slots[slot] != empty_slot; slot = next(slot)) {"s,
+      "               auto const mask = slots.size() - 1;"s,
+      "               if (((slot - home(values[slots[slot]].first)) & mask) >= ((slot - gap) & mask)) {"s,
+      "                  slots[gap] = slots[slot];"s,
+      "                  gap = slot;"s,
+      "                  }"s,
+      "               }"s,
+      "            slots[gap] = empty_slot;"s,
+      "            // the last element fills the position of the erased element"s,
+      "            if (auto const last = values.size() - 1; pos != last) {"s,
+      "               slots[lookup(values[last].first)] = pos;"s,
+      "               values[pos] = std::move(values[last]);"s,
+      "               }"s,
+      "            values.pop_back();"s,
+      "            return 1;"s,
+      "            }"s,
+      ""s,
+      "         iterator erase(const_iterator it) {"s,
+      "            auto const pos = it - values.cbegin();"s,
+      "            key_ty key = it->first;"s,
+      "            erase(key);"s,
+      "            return values.begin() + pos;"s,
+      "            }"s,
+      "      };"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   struct is_hash_map : std::false_type {};"s,
+      ""s,
+      "   template <typename key_ty, typename value_ty, typename hash_ty, typename equal_ty>"s,
+      "   struct is_hash_map<hash_map<key_ty, value_ty, hash_ty, equal_ty>> : std::true_type {};"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   constexpr bool is_hash_map_v = is_hash_map<ty>::value;"s,
+      ""s,
+      "   template <typename ty>"s,
+      "   struct used_type_for_container<ty, std::enable_if_t<is_hash_map<ty>::value>> {"s,
+      "      using type = typename ty::mapped_type;"s,
+      "      };"s,
 
       "   }"s,
       ""s
@@ -861,64 +1303,74 @@ bool TMyDictionary::CreateBaseDefintionFile(std::ostream& out) const {
 }
 
 std::vector<std::string> TMyDictionary::TopologicalSequence() const {
-  auto tmpTables = Tables() | std::views::keys | std::ranges::to<std::vector>();
-
-  std::sort(tmpTables.begin(), tmpTables.end(), [this](auto const& lhs, auto const& rhs) {
-          if (auto cmp = this->FindTable(lhs).Namespace() <=> this->FindTable(rhs).Namespace(); cmp != 0) return cmp < 0;
-          else return lhs < rhs;
-          });
-
-
-   std::unordered_map<std::string, std::set<std::string>> dependencies;
-   for (auto const& tab : tmpTables) {
-      auto const& table = FindTable(tab);
-      auto parents = table.GetParents(EMyReferenceType::generalization)
-                             | std::views::transform([](auto const& t) -> std::string { return t.Name(); })
-                             | std::ranges::to<std::vector>();
-      auto part_of_data = table.GetPart_ofs(EMyReferenceType::composition)
-                             | std::views::transform([](auto const& t) -> std::string { return std::get<0>(t).Name(); })
-                             | std::ranges::to<std::vector>();
-
-      //auto concatenated = std::ranges::views::concat(parents, part_of_data);
-      auto concatenated = std::views::join(std::array { parents, part_of_data } ) | std::ranges::to<std::set>();
-      if (concatenated.size() > 0)
-         dependencies.emplace(std::piecewise_construct, std::forward_as_tuple(tab), std::forward_as_tuple(concatenated));
+   auto const& link = Linkage();
+   size_t const iTables = link.tables_by_id.size();
+
+   // rank of every table for the order (Namespace, Name), tables without open dependencies are processed in this order
+   auto order = std::views::iota(size_t { 0 }, iTables) | std::ranges::to<std::vector>();
+   std::ranges::sort(order, [&link](size_t lhs, size_t rhs) {
+         if (auto cmp = link.tables_by_id[lhs]->Namespace() <=> link.tables_by_id[rhs]->Namespace(); cmp != 0) return cmp < 0;
+         else return lhs < rhs;  // ids are in the sequence of the names
+         });
+   std::vector<size_t> rank(iTables);
+   for (size_t i = 0; i < iTables; ++i) rank[order[i]] = i;
+
+   // a table depends on its generalizations and on the tables composed in it
+   std::vector<std::vector<size_t>> dependencies(iTables), dependents(iTables);
+   for (size_t id = 0; id < iTables; ++id) {
+      auto const& table = *link.tables_by_id[id];
+      auto& deps = dependencies[id];
+      for (auto const& ref : table.References()) {
+         if (ref.ReferenceType() == EMyReferenceType::generalization) deps.emplace_back(ref.GetRefTable().LinkID());
+         }
+      for (auto const& [part, reference] : link.referrers[static_cast<size_t>(EMyReferenceType::composition)][id]) {
+         if (part->LinkID() != id) deps.emplace_back(part->LinkID());
+         }
+      std::ranges::sort(deps);
+      deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+      for (auto dep : deps) dependents[dep].emplace_back(id);
       }
 
-   auto zero_indegree = tmpTables | std::views::filter([&dependencies](auto const& t) { 
-                                              return dependencies.find(t) == dependencies.end(); 
-                                              })
-                                  | std::ranges::to<std::deque>();
-
+   std::vector<size_t> indegree = dependencies | std::views::transform([](auto const& deps) { return deps.size(); })
+                                               | std::ranges::to<std::vector>();
 
-   std::sort(zero_indegree.begin(), zero_indegree.end(), [this](auto const& lhs, auto const& rhs) {
-         if (auto cmp = this->FindTable(lhs).Namespace() <=> this->FindTable(rhs).Namespace(); cmp != 0) return cmp < 0;
-         else return lhs < rhs;
-         } );
+   // first in, first out like before: the ready tables in the order (Namespace, Name), tables which become ready
+   // later are appended behind them, the tables freed by one table in the order (Namespace, Name) too
+   auto by_rank = [&rank](size_t lhs, size_t rhs) { return rank[lhs] < rank[rhs]; };
+   std::deque<size_t> zero_indegree = order | std::views::filter([&indegree](size_t id) { return indegree[id] == 0; })
+                                            | std::ranges::to<std::deque>();
 
    std::vector<std::string> sorted;
-
+   sorted.reserve(iTables);
+   std::vector<size_t> ready;
    while (!zero_indegree.empty()) {
-      std::string class_name = zero_indegree.front();
+      auto const id = zero_indegree.front();
       zero_indegree.pop_front();
-      sorted.emplace_back(class_name);
-
-      for (auto& dep_tables : dependencies) {
-         if (dep_tables.second.find(class_name) != dep_tables.second.end()) {
-            dep_tables.second.erase(class_name);
-            if (dep_tables.second.size() == 0) {
-               zero_indegree.push_back(dep_tables.first);
-               }
-            }
+      sorted.emplace_back(link.tables_by_id[id]->Name());
+      ready.clear();
+      for (auto dependent : dependents[id]) {
+         if (--indegree[dependent] == 0) ready.emplace_back(dependent);
          }
-
-      std::erase_if(dependencies, [](const auto& value) {
-         return value.second.size() == 0;
-         });
+      std::ranges::sort(ready, by_rank);
+      zero_indegree.insert(zero_indegree.end(), ready.begin(), ready.end());
       }
 
-   if (sorted.size() != tmpTables.size()) {
-      throw std::runtime_error("There is an inconsistency (a cycle) in the dependencies!");
+   if (sorted.size() != iTables) [[unlikely]] {
+      // every remaining table has an open dependency, following them leads to a cycle
+      auto is_open = [&indegree](size_t id) { return indegree[id] > 0; };
+      size_t current = *std::ranges::find_if(order, is_open);
+      std::vector<size_t> path;
+      std::vector<size_t> position(iTables, iTables);
+      while (position[current] == iTables) {
+         position[current] = path.size();
+         path.emplace_back(current);
+         current = *std::ranges::find_if(dependencies[current], is_open);
+         }
+
+      std::string strCycle;
+      for (auto id : path | std::views::drop(position[current])) strCycle += link.tables_by_id[id]->Name() + " -> "s;
+      strCycle += link.tables_by_id[current]->Name();
+      throw std::runtime_error("There is a cycle in the dependencies of the tables: "s + strCycle);
       }
 
    return sorted;
@@ -949,7 +1401,7 @@ void TMyDictionary::Test() const {
                         | std::views::values
                         | std::views::transform([](auto const& t) { return t.Attributes(); })
                         | std::views::join
-                        | std::views::transform([](auto const& a) { return a.Table().Dictionary().FindDataType(a.DataType()); })
+                        | std::views::transform([](auto const& a) { return a.GetDataType(); })
                         | std::ranges::to<std::set>();
 
    for (auto const& datatype : all_datatypes) {
@@ -961,7 +1413,7 @@ void TMyDictionary::Test() const {
                                   | std::views::join;
 
    for (auto const& attr : all_attributes) {
-      auto const& datatype = attr.Table().Dictionary().FindDataType(attr.DataType());
+      auto const& datatype = attr.GetDataType();
       std::cout << std::format("{} {}::{}\n", datatype.CorbaType(), attr.Table().Name(), attr.Name());
       }
    */
@@ -14,6 +14,11 @@
 
 #include "GenerateSQL.h"
 #include "TypesSQLGen.h"
+#include "MySymbolTable.h"
+#include "MyBitset.h"
+#include "MyTextBuffer.h"
+#include "MyStringArena.h"
+#include "MyOutputBackend.h"
 
 #include <iostream>
 #include <iomanip>
@@ -23,10 +28,19 @@
 #include <map>
 #include <set>
 #include <vector>
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <filesystem>
 #include <format>
 #include <ranges>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <atomic>
 
 namespace fs = std::filesystem;
 using namespace std::string_literals;
@@ -51,9 +65,10 @@ struct my_indent {
    std::string string() const { return std::string(iCnt * iSize, ' '); }
    };
 
-// overloading for the << operator for my_indent as strem manipulator
+// overloading for the << operator for my_indent as strem manipulator, the spaces are written directly into the stream buffer
 inline std::ostream& operator << (std::ostream& os, my_indent const& mi) {
-   return os << std::format("{:>{}}", "", mi.iCnt * mi.iSize);
+   std::fill_n(std::ostreambuf_iterator<char>(os), std::max(mi.iCnt * mi.iSize, 0), ' ');
+   return os;
    }
 
 template <>
@@ -64,7 +79,7 @@ struct std::formatter<my_indent> {
 
    template <typename FormatContext>
    auto format(my_indent const& p, FormatContext& ctx) const {
-      return std::format_to(ctx.out(), "{}", p.string());
+      return std::fill_n(ctx.out(), std::max(p.iCnt * p.iSize, 0), ' ');
       }
    };
 
@@ -77,7 +92,8 @@ class TMyAttribute;
 
 class TMyDatatype {
 private:
-   using myData = std::tuple<std::string, std::string, bool, bool, bool, std::string, std::string, std::string, std::string, std::string, std::string, bool, std::string>;
+   /// \brief internal type for all attributes in this class, the comment is a text in the arena of the dictionary
+   using myData = std::tuple<std::string, std::string, bool, bool, bool, std::string, std::string, std::string, std::string, std::string, std::string, bool, std::string_view>;
    myData data;
    TMyDictionary const& dictionary;
 public:
@@ -92,7 +108,7 @@ public:
                bool pUseLen, bool pUseScale, bool pWithLike, std::string const& pCheck, 
                std::string const& pSourceType, std::string const& pHeader, std::string const& pPrefix,
                std::string const& pCorbaType, std::string const& pCorbaModule,
-               bool pUseReference, std::string const& pComment) :
+               bool pUseReference, std::string_view pComment) :
       dictionary { dict },
       data{ myData { pDataType, pDatabaseType, pUseLen, pUseScale, pWithLike, pCheck, pSourceType, pHeader, pPrefix, pCorbaType, pCorbaModule, pUseReference, pComment } } { }
 
@@ -115,7 +131,7 @@ public:
 
 
    bool               UseReference() const { return std::get<11>(data); }
-   std::string const& Comment() const { return std::get<12>(data); }
+   std::string_view   Comment() const { return std::get<12>(data); }
 
 };
 
@@ -127,13 +143,16 @@ enum class EMyCalculationKinds : uint32_t { undefined = 0, attribute, attribute_
 
 class TMyAttribute {
 private:
+   /// \brief internal type for all attributes in this class, description and comment are texts in the arena of the dictionary
    using myData = std::tuple<int, std::string, std::string, std::string, size_t, size_t, bool, bool, std::string, 
-                             EMyCheckKinds, std::string, std::string, EMyCalculationKinds, std::string, std::string, std::string>;
+                             EMyCheckKinds, std::string, std::string, EMyCalculationKinds, std::string, std::string_view, std::string_view>;
    myData data;
    TMyTable const& table;
+   mutable TMyDatatype const* resolved_datatype = nullptr; ///< datatype resolved by TMyDictionary::Link, nullptr before
+   friend class TMyDictionary;
 public:
    TMyAttribute() = delete;
-   TMyAttribute(TMyAttribute const& other) : table(other.table), data(other.data) {  }
+   TMyAttribute(TMyAttribute const& other) : table(other.table), data(other.data), resolved_datatype(other.resolved_datatype) {  }
    //TMyAttribute(TMyAttribute&& other) noexcept : table(std::move(other.table)), data(std::move(other.data)) { }
    ~TMyAttribute() = default;
 
@@ -145,7 +164,7 @@ public:
                 size_t pLen, size_t pScale, bool pNotNull, bool pPrimary, std::string const& pCheck, EMyCheckKinds pCheckKind,
                 std::string const& pInit, std::string const& pComputed, EMyCalculationKinds pCalcKind, std::string const& pDenotation) :
       table { pTable },
-      data{ myData { pID, pName, pDBName, pDataType, pLen, pScale, pNotNull, pPrimary, pCheck, pCheckKind, pInit, pComputed, pCalcKind, pDenotation, "", "" } } { }
+      data{ myData { pID, pName, pDBName, pDataType, pLen, pScale, pNotNull, pPrimary, pCheck, pCheckKind, pInit, pComputed, pCalcKind, pDenotation, { }, { } } } { }
 
    // Einschub, Darstellung der Mglichkeiten
    operator size_t() { return ID(); }
@@ -167,8 +186,8 @@ public:
    EMyCalculationKinds KindOfCalulate() const { return std::get<12>(data); }
 
    std::string const& Denotation() const { return std::get<13>(data); }
-   std::string const& Description() const { return std::get<14>(data); }
-   std::string const& Comment() const { return std::get<15>(data); }
+   std::string_view   Description() const { return std::get<14>(data); }
+   std::string_view   Comment() const { return std::get<15>(data); }
 
    TMyTable const& Table() const { return table;  }
 
@@ -180,8 +199,6 @@ public:
    TMyDatatype const& GetDataType() const;
 private:
    std::string& Denotation() { return std::get<13>(data); }
-   std::string& Description() { return std::get<14>(data); }
-   std::string& Comment() { return std::get<15>(data); }
 
 };
 
@@ -198,15 +215,17 @@ public:
                               /** \brief attribute in referenced table */ size_t>;
 private:
    /// \\brief internal type for all attributes in this class
-   using myData = std::tuple<std::string, EMyReferenceType, std::string, std::string, 
-                            std::string, std::optional<size_t>, std::string, std::vector<myValues>>;
+   using myData = std::tuple<std::string, EMyReferenceType, std::string, std::string_view, 
+                            std::string, std::optional<size_t>, std::string_view, std::vector<myValues>>;
 
    myData data; ///< internal data element 
    TMyTable const& table; ///< reference to the table which use this as foreign key
+   mutable TMyTable const* resolved_table = nullptr; ///< referenced table resolved by TMyDictionary::Link, nullptr before
+   friend class TMyDictionary;
 
 public:
    TMyReferences() = delete;
-   TMyReferences(TMyReferences const& other) : table(other.table), data(other.data) {  }
+   TMyReferences(TMyReferences const& other) : table(other.table), data(other.data), resolved_table(other.resolved_table) {  }
    ~TMyReferences() = default;
 
    auto operator <=> (TMyReferences const& other) const { return data <=> other.data; }
@@ -214,8 +233,8 @@ public:
    auto const& GetKey() const { return std::get<0>(data); }
 
    TMyReferences(TMyTable const& pTable, std::string const& pName, EMyReferenceType pRefType, std::string const& pRefTable, 
-                 std::string const& pDescription, std::string const& pCardinality, std::optional<size_t> const& pShowAttribute,
-                 std::string const& pComment, std::vector<myValues>&& pValues) :
+                 std::string_view pDescription, std::string const& pCardinality, std::optional<size_t> const& pShowAttribute,
+                 std::string_view pComment, std::vector<myValues>&& pValues) :
       table{ pTable },
       data{ myData { pName, pRefType, pRefTable, pDescription, pCardinality,  pShowAttribute, pComment, std::move(pValues) } } { }
 
@@ -223,13 +242,25 @@ public:
    std::string const& Name() const { return std::get<0>(data); }
    EMyReferenceType             ReferenceType() const { return std::get<1>(data); }
    std::string const&           RefTable() const { return std::get<2>(data); }
-   std::string const&           Description() const { return std::get<3>(data); }
+   std::string_view             Description() const { return std::get<3>(data); }
    std::string const&           Cardinality() const { return std::get<4>(data); }
    std::optional<size_t> const& ShowAttribute() const { return std::get<5>(data); }
-   std::string const&           Comment() const { return std::get<6>(data); }
+   std::string_view             Comment() const { return std::get<6>(data); }
    std::vector<myValues> const& Values() const { return std::get<7>(data); }
 
    std::string ReferenceTypeTxt() const;
+
+   /// \brief referenced table, direct after TMyDictionary::Link, otherwise with a search in the dictionary
+   TMyTable const& GetRefTable() const;
+
+   /// \brief pair of attributes joined by a value of the reference
+   struct my_joined_attributes {
+      TMyAttribute const& attribute;      ///< attribute in the table with this reference
+      TMyAttribute const& ref_attribute;  ///< attribute in the referenced table
+      };
+
+   /// \brief attributes of both tables in the sequence of the values, found with the attribute index of the tables, without copies
+   std::vector<my_joined_attributes> JoinedAttributes() const;
    };
 
 using myReferences = std::vector<TMyReferences>;
@@ -268,6 +299,16 @@ using myIndices = std::vector<TMyIndices>;
 
 enum class EMyEntityType : uint32_t { undefined, table, range, relationship, view };
 
+/// \brief layout of the data elements in the generated data classes
+/// \details optional = one std::optional for every attribute, null_bitmap = plain members sorted by their alignment
+///          and one bitmap for all attributes with the NULL state, the public selectors and manipulators are the same
+enum class EMyRecordLayout : uint32_t { optional, null_bitmap };
+
+/// \brief type of container_ty in the generated data classes
+/// \details map = std::map with the primary key, flat_map = own::flat_map from BaseDefinitions.h, a sorted vector
+///          with the primary key for read mostly data, loaded with one sort
+enum class EMyContainerType : uint32_t { map, flat_map };
+
 
 class TMyNameSpace {
 private:
@@ -330,8 +371,8 @@ private:
                              std::string,   //  6, path to the source file - SrcPath
                              std::string,   //  7, path to the sql file - SQLPath
                              std::string,   //  8, denotation for this table - Denotation 
-                             std::string, 
-                             std::string, 
+                             std::string_view, //  9, description in the arena of the dictionary - Description
+                             std::string_view, // 10, comment in the arena of the dictionary - Comment
                              myAttributes, 
                              myReferences, 
                              myIndices, 
@@ -340,22 +381,37 @@ private:
                              myStatements>;
    myData data;
    TMyDictionary const& dictionary;
+   mutable TMySymbolTable::symbol_id iLinkID = TMySymbolTable::npos; ///< dense id of the table, set by TMyDictionary::Link
+   std::optional<EMyContainerType> container_type;  ///< container_ty for this table, without value the type of the dictionary
+   friend class TMyDictionary;
+
+   /// \brief index for the attributes of the table, built by TMyDictionary::Link
+   /// \details the keys refer to the names in the attributes, AddAttribute and TMyDictionary::Unlink drop the index.
+   ///          without index (before the link step) FindAttribute searches linear
+   struct my_attribute_index {
+      std::unordered_map<std::string_view, size_t>  by_name;          ///< position of the attribute for the name
+      std::vector<size_t>                           by_id;            ///< position of the attribute for the id, npos for gaps, empty for sparse ids
+      };
+   mutable std::unique_ptr<my_attribute_index const> attribute_index; ///< only read while linked, the generators search parallel
+   void BuildAttributeIndex() const;
  
    /// internal datatype with all composed tables and necessary informations about this
    /// class which used for this relationship (direction may differ from the database)
-   using my_part_of_type = std::tuple<TMyTable, std::string, std::string, std::vector<size_t>, std::vector<std::pair<size_t, size_t>>>;
+   /// the table is a reference to the table in the dictionary, no copy
+   using my_part_of_type = std::tuple<TMyTable const&, std::string, std::string, std::vector<size_t>, std::vector<std::pair<size_t, size_t>>>;
 
 public:
    TMyTable() = delete;
-   TMyTable(TMyTable const& other) : dictionary(other.dictionary), data(other.data) { }
-   TMyTable(TMyTable&& other) noexcept : dictionary(other.dictionary), data(other.data) { }
+   TMyTable(TMyTable const& other) : dictionary(other.dictionary), data(other.data), iLinkID(other.iLinkID), container_type(other.container_type) { }
+   TMyTable(TMyTable&& other) noexcept : dictionary(other.dictionary), data(std::move(other.data)), iLinkID(other.iLinkID),
+                                         container_type(other.container_type) { }
 
 
    TMyTable(TMyDictionary const& dict, std::string const& pName, EMyEntityType pType, std::string const& pSQLName, std::string const& pSchema,
             std::string const& pSourceName, std::string const& pNamespace,     
             std::string const& pSrcPath, std::string const& pSQLPath, std::string const& pDenotation) :
       dictionary { dict },
-      data { myData { pName, pType, pSQLName, pSchema, pSourceName, pNamespace, pSrcPath, pSQLPath, pDenotation, ""s, ""s,
+      data { myData { pName, pType, pSQLName, pSchema, pSourceName, pNamespace, pSrcPath, pSQLPath, pDenotation, { }, { },
                      { }, { }, { }, { }, { }, { } } } { }
 
 
@@ -379,15 +435,9 @@ public:
 
    std::string const& Denotation() const { return std::get<8>(data); }
 
-   std::string const& Description() const { return std::get<9>(data); }
-   std::string const& Comment() const { return std::get<10>(data); }
-
-private:
-   // keep things together, manipulators for this data elements as private
-   std::string&       Description() { return std::get<9>(data); }
-   std::string&       Comment() { return std::get<10>(data); }
+   std::string_view   Description() const { return std::get<9>(data); }
+   std::string_view   Comment() const { return std::get<10>(data); }
 
-public:
 
    std::string FullyQualifiedSQLName() const { return SQLSchema().size() > 0 ? SQLSchema() + "." + SQLName() : SQLName(); }
    std::string FullyQualifiedSourceName() const { return Namespace().size() > 0 ? Namespace() + "::" + ClassName() : ClassName(); }
@@ -395,6 +445,12 @@ public:
    std::string Doc_RefName() const { return "datamodel_table_"s + Name(); }
 
    std::string Include() const { return "\""s + (SrcPath().size() > 0 ? SrcPath() + "\\"s : ""s) + SourceName() + ".h\""; }
+
+   /// \brief type of container_ty for this table, the own type or the type of the dictionary
+   EMyContainerType ContainerType() const;
+   std::optional<EMyContainerType> const& OwnContainerType() const { return container_type; }
+
+   TMySymbolTable::symbol_id LinkID() const { return iLinkID; } ///< dense id after TMyDictionary::Link, npos before
    /// \}
 
    TMyDictionary const& Dictionary() const { return dictionary; }
@@ -420,7 +476,7 @@ public:
    TMyAttribute const& FindAttribute(std::string const& strName) const;
    TMyAttribute const& FindAttribute(size_t iID) const;
 
-   std::vector<TMyTable>         GetParents(EMyReferenceType ref_type = EMyReferenceType::generalization) const;
+   std::vector<std::reference_wrapper<TMyTable const>> GetParents(EMyReferenceType ref_type = EMyReferenceType::generalization) const;
    std::vector<my_part_of_type>  GetParent_ofs(EMyReferenceType ref_type = EMyReferenceType::generalization) const;
    std::vector<my_part_of_type>  GetPart_ofs(EMyReferenceType ref_type = EMyReferenceType::composition) const;
    std::vector<std::pair<TMyAttribute, TMyDatatype>> GetProcessing_Data() const;
@@ -443,14 +499,25 @@ public:
    TMyTable& AddDescription(std::string const& pDescription);
    TMyTable& AddComment(std::string const& pComment);
 
+   /// \brief container_ty of this table differs from the container type of the dictionary
+   TMyTable& OwnContainerType(EMyContainerType pType) { container_type = pType; return *this; }
+
    /// \name create source for table
    /// {
    bool CreateHeader(std::ostream& os) const;
    bool CreateSource(std::ostream& os, bool boInline = false) const;
+   /// \brief column container columns_ty (structure of arrays), part of the header file with TMyDictionary::ColumnContainer()
+   void CreateColumns(std::ostream& os) const;
+   /// \brief the primary_key is packed into one or two integers for the comparisons and the hash (integral attributes only)
+   bool PackedKey() const;
    /// }
 
    bool CreateDox(std::ostream& os) const;
 
+   /// \brief hash of all values of the table, attributes, references, indices and statements (DictionarySnapshot.cpp)
+   /// \details two tables with the same fingerprint create the same files, used to detect changed tables
+   uint64_t Fingerprint() const;
+
    //private:
       std::set<std::string> GetPrecursors(bool boAll = true) const;
       std::set<std::string> GetSuccessors(bool boAll = true) const;
@@ -465,6 +532,42 @@ using myTables = std::map<std::string, TMyTable>;
 
 
 class TMyDictionary {
+public:
+   /// \brief table with a reference to another table, entry in the reverse index of the references
+   struct my_referrer {
+      TMyTable const*      table;                        ///< table which holds the reference
+      TMyReferences const* reference;                    ///< reference to the other table
+      };
+
+   /// \brief selection of the files for Create_Selected, the default selects all files
+   struct my_artifacts {
+      bool boProjectFiles = true;    ///< files which depend only on the settings (base definitions, base class, basic corba files)
+      bool boModelFiles   = true;    ///< files with all tables (sql scripts, documentation of the project, reader, corba idl)
+      /// tables for which the header, source and dox files are created and the sql statements are prepared, without value
+      /// all tables. statements of other tables missing in the cache are built when the files with all tables are written
+      std::optional<std::set<std::string>> tables;
+      };
+
+   /// \brief count of the values in EMyReferenceType, size for the reverse index
+   static constexpr size_t iReferenceTypes = static_cast<size_t>(EMyReferenceType::composition) + 1;
+
+   /// \brief result of the link step, names of tables and datatypes interned to dense ids
+   struct my_linkage {
+      TMySymbolTable                  table_names;       ///< names of the tables, the id is index for tables_by_id
+      TMySymbolTable                  datatype_names;    ///< names of the datatypes, the id is index for datatypes_by_id
+      std::vector<TMyTable const*>    tables_by_id;      ///< tables in the sequence of the ids
+      std::vector<TMyDatatype const*> datatypes_by_id;   ///< datatypes in the sequence of the ids
+      /// reverse index, for every type of reference and every table id the tables referring this table
+      std::array<std::vector<std::vector<my_referrer>>, iReferenceTypes> referrers;
+
+      /// direct dependencies (generalization, composition, range) for every table id, precursors include self references
+      std::vector<std::vector<TMySymbolTable::symbol_id>> direct_precursors;
+      std::vector<std::vector<TMySymbolTable::symbol_id>> direct_successors;  ///< direct successors without the table self
+      std::vector<TMyBitset>                              precursors;         ///< transitive closure of direct_precursors
+      std::vector<TMyBitset>                              successors;         ///< transitive closure of direct_successors
+      };
+
+private:
    std::string   strName        = "default"s;   ///< name of the project
    std::string   strDenotation  = ""s;          ///< denotation / denomination of the Project
    std::string   strVersion     = "1.0"s;       ///< version id for the project
@@ -497,6 +600,14 @@ class TMyDictionary {
    std::string strPersistenceDatabase;          ///< name of the database of the application
 
    bool        boWithCorba = true;              ///< create corba idl and basic implementation for this project;
+   unsigned int iThreads = 0;                   ///< count of worker threads for Create_All, 0 = hardware concurrency
+   fs::path    pathManifest;                    ///< file with the hashes of the generated files, empty = compare with existing files
+   bool        boTimings = false;               ///< Create_All writes a summary with the times of the phases to the protocol
+   fs::path    pathTraceFile;                   ///< Create_All writes the times of all jobs as chrome trace into this file, empty = no trace
+   EMyRecordLayout eRecordLayout = EMyRecordLayout::optional; ///< layout of the data elements in the generated classes
+   bool        boColumnContainer = false;       ///< the generated classes get the column container columns_ty (structure of arrays)
+   EMyContainerType eContainerType = EMyContainerType::map; ///< container_ty of the generated classes, tables can use another type
+   bool        boHashContainer = false;         ///< the generated classes get hash_container_ty, a hash map with open addressing
 
    myDataTypes   datatypes;                     ///< container with the datatypes for this project
    myTables      tables;                        ///< container with all tables inside of this project
@@ -504,6 +615,12 @@ class TMyDictionary {
    myDirectories directories;                   ///< container with defined subdirectories of this project
 
    Generator_SQL buildSQLRef{ *this };         ///< reference to an element of the sql generator class
+
+   mutable std::unique_ptr<my_linkage> linkage;           ///< result of the link step, valid when boLinked is true
+   mutable std::atomic<bool>           boLinked = false;  ///< true when the link step is done and the model unchanged since
+   mutable std::mutex                  mtxLinkage;        ///< lock for the lazy link step
+
+   mutable TMyStringArena              texts;             ///< storage for comments and descriptions of the entities
 public:
 
    TMyDictionary() = default;
@@ -553,6 +670,14 @@ public:
                                                                    PersistenceNamespace() + "::"s : ""s) + 
                                                                    PersistenceClass(); }
 
+   unsigned int             Threads() const { return iThreads; }
+   fs::path const&          ManifestFile() const { return pathManifest; }
+   bool                     Timings() const { return boTimings; }
+   fs::path const&          TraceFile() const { return pathTraceFile; }
+   EMyRecordLayout          RecordLayout() const { return eRecordLayout; }
+   bool                     ColumnContainer() const { return boColumnContainer; }
+   EMyContainerType         ContainerType() const { return eContainerType; }
+   bool                     HashContainer() const { return boHashContainer; }
 
    /// \}
    
@@ -589,6 +714,15 @@ public:
    std::string const& PersistenceServerType(std::string const& newVal) { return strPersistenceServerType = newVal; };
    std::string const& PersistenceDatabase(std::string const& newVal) { return  strPersistenceDatabase = newVal; }
 
+   unsigned int       Threads(unsigned int newVal) { return iThreads = newVal; }
+   fs::path const&    ManifestFile(fs::path const& newVal) { return pathManifest = newVal; }
+   bool               Timings(bool newVal) { return boTimings = newVal; }
+   fs::path const&    TraceFile(fs::path const& newVal) { return pathTraceFile = newVal; }
+   EMyRecordLayout    RecordLayout(EMyRecordLayout newVal) { return eRecordLayout = newVal; }
+   bool               ColumnContainer(bool newVal) { return boColumnContainer = newVal; }
+   EMyContainerType   ContainerType(EMyContainerType newVal) { return eContainerType = newVal; }
+   bool               HashContainer(bool newVal) { return boHashContainer = newVal; }
+
    /// \}
 
    /** \name methods to work with the datatypes
@@ -603,6 +737,41 @@ public:
    /// \}
 
 
+   /// \brief arena for the comments and descriptions of the entities, the texts stay valid with the dictionary
+   TMyStringArena&   Texts() const { return texts; }
+
+   /** \name binary snapshot of the complete model for a warm start (DictionarySnapshot.cpp)
+       \details LoadSnapshot needs an empty dictionary, it returns false when the file doesn't exist, has another
+                version or another source hash. then the model must be built again and saved with SaveSnapshot.
+   \{ */
+   void SaveSnapshot(fs::path const& file, uint64_t iSourceHash = 0) const;
+   bool LoadSnapshot(fs::path const& file, uint64_t iSourceHash = 0);
+
+   /// \brief hash of the settings, datatypes, namespaces and directories without the tables, see TMyTable::Fingerprint()
+   uint64_t Fingerprint() const;
+   /// \}
+
+   /** \name link step, names resolved to dense ids and direct pointers
+       \details after the model is complete, Link() interns the names of all tables and datatypes and resolves the
+                datatypes of the attributes and the referenced tables of the references. the generators use this
+                without searches in the maps. the manipulators of the model call Unlink(), Linkage() links again when needed.
+   \{ */
+   void              Link() const;
+   void              Unlink() const;
+   bool              IsLinked() const { return boLinked.load(std::memory_order_acquire); }
+   my_linkage const& Linkage() const;
+
+   /// \brief tables with a reference of type ref_type to table, in the sequence of the tables and their references
+   std::vector<my_referrer> const& Referrers(TMyTable const& table, EMyReferenceType ref_type) const;
+
+   /// \brief all direct and indirect precursors of table as bitset over the link ids
+   TMyBitset const& Precursors(TMyTable const& table) const;
+   /// \brief all direct and indirect successors of table as bitset over the link ids
+   TMyBitset const& Successors(TMyTable const& table) const;
+   /// \brief check if precursor is a direct or indirect precursor of table
+   bool             IsPrecursor(TMyTable const& precursor, TMyTable const& table) const;
+   /// \}
+
    /** \name methods to work with the tables
    \{ */
    TMyTable& FindTable(std::string const& strTable);
@@ -643,8 +812,18 @@ public:
    bool CreateCorbaImplementationHeader(std::ostream& out) const;
    bool CreateCorbaImplementationSource(std::ostream& out, std::string const& strHeader) const;
 
+   /// \brief create all files of the project, the files are written in parallel by Threads() worker threads
+   /// \details only files with changed content are written, see ManifestFile() and TMyOutputWriter.
+   ///          with Timings() or TraceFile() every job is measured, see TMyInstrumentation
    void Create_All(std::ostream& out = std::cout, std::ostream& err = std::cerr) const;
 
+   /// \brief create all files of the project into the output backend, e.g. TMyMemoryOutput for a run without filesystem
+   /// \details the paths of the files are the same like for the filesystem, ManifestFile() isn't used
+   void Create_All(TMyOutputBackend& output, std::ostream& out = std::cout, std::ostream& err = std::cerr) const;
+
+   /// \brief create only the selected files of the project into the output backend, used by TMyModelWatcher
+   void Create_Selected(TMyOutputBackend& output, my_artifacts const& artifacts, std::ostream& out = std::cout, std::ostream& err = std::cerr) const;
+
 
    Generator_SQL const& sql_builder() const { return buildSQLRef; }
 
@@ -655,6 +834,11 @@ public:
    void Test() const;
 
 private:
+   TMySymbolTable::symbol_id LinkedID(TMyTable const& table) const;
+
+   /// \brief values of the snapshot, without tables for the fingerprint (DictionarySnapshot.cpp)
+   std::string SnapshotPayload(bool boTables) const;
+
    std::vector<std::tuple<std::string, std::string, std::vector<size_t>>> GetCompositions(TMyTable const&) const;
    std::vector<std::tuple<std::string, std::string, std::string, std::string, std::vector<size_t>>> GetRangeValues(TMyTable const& table) const;
 
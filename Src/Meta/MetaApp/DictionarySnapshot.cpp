@@ -0,0 +1,367 @@
+/** \file
+   \brief binary snapshot of a complete TMyDictionary
+   \details the snapshot contains all parts of the model (settings, datatypes, namespaces, directories, tables
+            with attributes, references, indices and statements) as flat sequence of values without pointers.
+            LoadSnapshot builds the entities directly with the values, the checks of AddAttribute (regex for
+            check conditions and computed values) and the insertions with searches in the maps are skipped.
+            the snapshot is only valid for the same version of the format and the same byte order, a source
+            hash (e.g. of the model file) detects an outdated snapshot. the same values are used for the
+            fingerprints of the dictionary and the tables, which detect changed tables in TMyModelWatcher.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as cache for the warm start of the generator
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "DataDictionary.h"
+#include "MyMappedFile.h"
+
+#include <fstream>
+#include <cstring>
+#include <concepts>
+#include <type_traits>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace {
+   constexpr std::string_view strSnapshotMagic   = "MDDSNAP"sv;   ///< signature at the begin of the file
+   constexpr uint32_t         iSnapshotVersion   = 6;             ///< increase with every change of the entities or the sequence
+   constexpr uint32_t         iSnapshotByteOrder = 0x01020304;    ///< detects a snapshot of a system with other byte order
+
+   /// \brief header of the snapshot file, followed by iPayload bytes with the values
+   struct my_snapshot_header {
+      char     magic[8];
+      uint32_t iVersion;
+      uint32_t iByteOrder;
+      uint64_t iSourceHash;
+      uint64_t iPayload;
+      };
+
+   /// \brief collects the values of the snapshot in a buffer, integral values with 64 bit, texts with length
+   class my_snapshot_writer {
+      std::string buffer;
+   public:
+      std::string const& Buffer() const { return buffer; }
+      std::string        Extract() { return std::move(buffer); }
+
+      template <typename ty>
+         requires std::integral<ty> || std::is_enum_v<ty>
+      void Put(ty value) {
+         uint64_t const raw = static_cast<uint64_t>(value);
+         buffer.append(reinterpret_cast<char const*>(&raw), sizeof(raw));
+         }
+
+      void Put(std::string_view text) {
+         Put(text.size());
+         buffer.append(text);
+         }
+
+      void Put(std::string const& text) { Put(std::string_view(text)); }
+      void Put(fs::path const& path) { Put(path.string()); }
+
+      void Put(myStatements const& stmts) {
+         Put(stmts.size());
+         for (auto const& stmt : stmts) Put(stmt);
+         }
+      };
+
+   /// \brief reads the values of the snapshot as view into the mapped file
+   class my_snapshot_reader {
+      std::string_view rest;
+      std::string const& strFile;
+   public:
+      my_snapshot_reader(std::string_view pPayload, std::string const& pFile) : rest(pPayload), strFile(pFile) { }
+
+      bool AtEnd() const { return rest.empty(); }
+
+      template <typename ty>
+         requires std::integral<ty> || std::is_enum_v<ty>
+      ty Get() {
+         uint64_t raw;
+         std::memcpy(&raw, Take(sizeof(raw)).data(), sizeof(raw));
+         return static_cast<ty>(raw);
+         }
+
+      std::string_view View() { return Take(Get<size_t>()); }
+      std::string      Text() { return std::string(View()); }
+
+      myStatements Statements() {
+         myStatements stmts(Get<size_t>());
+         for (auto& stmt : stmts) stmt = Text();
+         return stmts;
+         }
+
+   private:
+      std::string_view Take(size_t size) {
+         if (size > rest.size()) [[unlikely]] throw std::runtime_error("snapshot \""s + strFile + "\" is truncated."s);
+         auto const part = rest.substr(0, size);
+         rest.remove_prefix(size);
+         return part;
+         }
+      };
+
+   /// \brief values of a table, used for the snapshot and the fingerprint of the table
+   void put_table(my_snapshot_writer& snapshot, TMyTable const& table) {
+      snapshot.Put(table.Name());       snapshot.Put(table.EntityType()); snapshot.Put(table.SQLName());    snapshot.Put(table.SQLSchema());
+      snapshot.Put(table.SourceName()); snapshot.Put(table.Namespace());  snapshot.Put(table.SrcPath());    snapshot.Put(table.SQLPath());
+      snapshot.Put(table.Denotation()); snapshot.Put(table.Description()); snapshot.Put(table.Comment());
+      snapshot.Put(table.OwnContainerType().has_value());
+      snapshot.Put(table.OwnContainerType().value_or(EMyContainerType::map));
+
+      snapshot.Put(table.Attributes().size());
+      for (auto const& attr : table.Attributes()) {
+         snapshot.Put(attr.ID());          snapshot.Put(attr.Name());         snapshot.Put(attr.DBName());   snapshot.Put(attr.DataType());
+         snapshot.Put(attr.Len());         snapshot.Put(attr.Scale());        snapshot.Put(attr.NotNull());  snapshot.Put(attr.Primary());
+         snapshot.Put(attr.CheckSeq());    snapshot.Put(attr.CheckAtTable()); snapshot.Put(attr.InitSeq());  snapshot.Put(attr.Computed());
+         snapshot.Put(attr.KindOfCalulate()); snapshot.Put(attr.Denotation()); snapshot.Put(attr.Description()); snapshot.Put(attr.Comment());
+         }
+
+      snapshot.Put(table.References().size());
+      for (auto const& ref : table.References()) {
+         snapshot.Put(ref.Name());        snapshot.Put(ref.ReferenceType()); snapshot.Put(ref.RefTable()); snapshot.Put(ref.Description());
+         snapshot.Put(ref.Cardinality()); snapshot.Put(ref.ShowAttribute().has_value());
+         snapshot.Put(ref.ShowAttribute().value_or(0));
+         snapshot.Put(ref.Comment());
+         snapshot.Put(ref.Values().size());
+         for (auto const& [attr, ref_attr] : ref.Values()) { snapshot.Put(attr); snapshot.Put(ref_attr); }
+         }
+
+      snapshot.Put(table.Indices().size());
+      for (auto const& idx : table.Indices()) {
+         snapshot.Put(idx.Name()); snapshot.Put(idx.IndexType()); snapshot.Put(idx.Comment());
+         snapshot.Put(idx.Values().size());
+         for (auto const& [attr, boAsc] : idx.Values()) { snapshot.Put(attr); snapshot.Put(boAsc); }
+         }
+
+      snapshot.Put(table.RangeValues());
+      snapshot.Put(table.PostConditions());
+      snapshot.Put(table.Cleanings());
+      }
+
+   /// \brief FNV-1a hash for the fingerprints
+   uint64_t payload_hash(std::string_view payload) {
+      uint64_t hash = 0xcbf29ce484222325ull;
+      for (unsigned char ch : payload) hash = (hash ^ ch) * 0x100000001b3ull;
+      return hash;
+      }
+   }
+
+
+std::string TMyDictionary::SnapshotPayload(bool boTables) const {
+   my_snapshot_writer snapshot;
+
+   for (auto const* text : { &strName, &strDenotation, &strVersion, &strDescription, &strComment, &strAuthor, &strCopyright, &strLicense,
+                             &strReaderClass, &strReaderFile, &strBaseClass, &strBaseNamespace, &strPersistenceClass, &strPersistenceNamespace,
+                             &strPersistenceName, &strPersistenceServerType, &strPersistenceDatabase }) snapshot.Put(*text);
+   for (auto const* path : { &pathSource, &pathSQL, &pathDoc, &pathIDL, &pathCorba, &pathToBase, &pathToPersistence, &pathManifest, &pathTraceFile }) snapshot.Put(*path);
+   snapshot.Put(boWithCorba);
+   snapshot.Put(boTimings);
+   snapshot.Put(eRecordLayout);
+   snapshot.Put(boColumnContainer);
+   snapshot.Put(eContainerType);
+   snapshot.Put(boHashContainer);
+   snapshot.Put(iThreads);
+
+   snapshot.Put(datatypes.size());
+   for (auto const& [name, datatype] : datatypes) {
+      snapshot.Put(datatype.DataType());     snapshot.Put(datatype.DatabaseType());
+      snapshot.Put(datatype.UseLen());       snapshot.Put(datatype.UseScale());   snapshot.Put(datatype.WithLike());
+      snapshot.Put(datatype.CheckSeq());     snapshot.Put(datatype.SourceType()); snapshot.Put(datatype.Headerfile());
+      snapshot.Put(datatype.Prefix());       snapshot.Put(datatype.CorbaType());  snapshot.Put(datatype.CorbaModule());
+      snapshot.Put(datatype.UseReference()); snapshot.Put(datatype.Comment());
+      }
+
+   snapshot.Put(namespaces.size());
+   for (auto const& [name, nsp] : namespaces) {
+      snapshot.Put(nsp.Name()); snapshot.Put(nsp.CorbaName()); snapshot.Put(nsp.Denotation()); snapshot.Put(nsp.Description()); snapshot.Put(nsp.Comment());
+      }
+
+   snapshot.Put(directories.size());
+   for (auto const& [name, dir] : directories) {
+      snapshot.Put(dir.Name()); snapshot.Put(dir.Denotation()); snapshot.Put(dir.Description());
+      }
+
+   if (boTables) {
+      snapshot.Put(tables.size());
+      for (auto const& [name, table] : tables) put_table(snapshot, table);
+      }
+   return snapshot.Extract();
+   }
+
+uint64_t TMyDictionary::Fingerprint() const {
+   return payload_hash(SnapshotPayload(false));
+   }
+
+uint64_t TMyTable::Fingerprint() const {
+   my_snapshot_writer snapshot;
+   put_table(snapshot, *this);
+   return payload_hash(snapshot.Buffer());
+   }
+
+
+void TMyDictionary::SaveSnapshot(fs::path const& file, uint64_t iSourceHash) const {
+   auto const payload = SnapshotPayload(true);
+   my_snapshot_header header { { }, iSnapshotVersion, iSnapshotByteOrder, iSourceHash, payload.size() };
+   std::memcpy(header.magic, strSnapshotMagic.data(), strSnapshotMagic.size());
+
+   std::ofstream ofs(file, std::ios::binary | std::ios::trunc);
+   if (!ofs.is_open()) [[unlikely]] throw std::runtime_error("snapshot \""s + file.string() + "\" couldn't opened."s);
+   ofs.write(reinterpret_cast<char const*>(&header), sizeof(header));
+   ofs.write(payload.data(), payload.size());
+   if (!ofs.flush()) [[unlikely]] throw std::runtime_error("snapshot \""s + file.string() + "\" couldn't written."s);
+   }
+
+
+bool TMyDictionary::LoadSnapshot(fs::path const& file, uint64_t iSourceHash) {
+   if (!datatypes.empty() || !tables.empty()) [[unlikely]]
+      throw std::runtime_error("snapshot \""s + file.string() + "\" can only be loaded into an empty dictionary."s);
+   if (!fs::exists(file)) return false;
+
+   TMyMappedFile mapping(file);
+   auto const content = mapping.Text();
+   my_snapshot_header header;
+   if (content.size() < sizeof(header)) return false;
+   std::memcpy(&header, content.data(), sizeof(header));
+   if (std::string_view(header.magic, strSnapshotMagic.size()) != strSnapshotMagic || header.iVersion != iSnapshotVersion ||
+       header.iByteOrder != iSnapshotByteOrder || header.iSourceHash != iSourceHash ||
+       header.iPayload != content.size() - sizeof(header)) return false;   // outdated or from another system, build the model again
+
+   std::string const strFile = file.string();
+   my_snapshot_reader snapshot(content.substr(sizeof(header)), strFile);
+
+   for (auto* text : { &strName, &strDenotation, &strVersion, &strDescription, &strComment, &strAuthor, &strCopyright, &strLicense,
+                       &strReaderClass, &strReaderFile, &strBaseClass, &strBaseNamespace, &strPersistenceClass, &strPersistenceNamespace,
+                       &strPersistenceName, &strPersistenceServerType, &strPersistenceDatabase }) *text = snapshot.Text();
+   for (auto* path : { &pathSource, &pathSQL, &pathDoc, &pathIDL, &pathCorba, &pathToBase, &pathToPersistence, &pathManifest, &pathTraceFile }) *path = snapshot.Text();
+   boWithCorba = snapshot.Get<bool>();
+   boTimings   = snapshot.Get<bool>();
+   eRecordLayout = snapshot.Get<EMyRecordLayout>();
+   boColumnContainer = snapshot.Get<bool>();
+   eContainerType = snapshot.Get<EMyContainerType>();
+   boHashContainer = snapshot.Get<bool>();
+   iThreads    = snapshot.Get<unsigned int>();
+
+   // the containers are written in the sequence of the keys, so every element is inserted at the end without search
+   for (auto iCount = snapshot.Get<size_t>(); iCount > 0; --iCount) {
+      auto strDataType = snapshot.Text();
+      auto strDatabaseType = snapshot.Text();
+      auto const boUseLen = snapshot.Get<bool>();
+      auto const boUseScale = snapshot.Get<bool>();
+      auto const boWithLike = snapshot.Get<bool>();
+      auto strCheck = snapshot.Text();
+      auto strSourceType = snapshot.Text();
+      auto strHeader = snapshot.Text();
+      auto strPrefix = snapshot.Text();
+      auto strCorbaType = snapshot.Text();
+      auto strCorbaModule = snapshot.Text();
+      auto const boUseReference = snapshot.Get<bool>();
+      auto const strDTComment = texts.Store(snapshot.View());
+      datatypes.emplace_hint(datatypes.end(), std::piecewise_construct, std::forward_as_tuple(strDataType),
+                             std::forward_as_tuple(*this, strDataType, strDatabaseType, boUseLen, boUseScale, boWithLike, strCheck,
+                                                   strSourceType, strHeader, strPrefix, strCorbaType, strCorbaModule, boUseReference, strDTComment));
+      }
+
+   for (auto iCount = snapshot.Get<size_t>(); iCount > 0; --iCount) {
+      auto strNspName = snapshot.Text();
+      auto strCorbaName = snapshot.Text();
+      auto strNspDenotation = snapshot.Text();
+      auto strNspDescription = snapshot.Text();
+      auto strNspComment = snapshot.Text();
+      namespaces.emplace_hint(namespaces.end(), std::piecewise_construct, std::forward_as_tuple(strNspName),
+                              std::forward_as_tuple(*this, strNspName, strCorbaName, strNspDenotation, strNspDescription, strNspComment));
+      }
+
+   for (auto iCount = snapshot.Get<size_t>(); iCount > 0; --iCount) {
+      auto strDirName = snapshot.Text();
+      auto strDirDenotation = snapshot.Text();
+      auto strDirDescription = snapshot.Text();
+      directories.emplace_hint(directories.end(), std::piecewise_construct, std::forward_as_tuple(strDirName),
+                               std::forward_as_tuple(*this, strDirName, strDirDenotation, strDirDescription));
+      }
+
+   for (auto iCount = snapshot.Get<size_t>(); iCount > 0; --iCount) {
+      auto strTable = snapshot.Text();
+      auto const type = snapshot.Get<EMyEntityType>();
+      auto strSQLName = snapshot.Text();
+      auto strSchema = snapshot.Text();
+      auto strSourceName = snapshot.Text();
+      auto strNamespace = snapshot.Text();
+      auto strSrcPath = snapshot.Text();
+      auto strSQLPath = snapshot.Text();
+      auto strTabDenotation = snapshot.Text();
+      // the table is inserted first, attributes, references and indices keep a reference to the table in the container
+      auto& table = tables.emplace_hint(tables.end(), std::piecewise_construct, std::forward_as_tuple(strTable),
+                                        std::forward_as_tuple(*this, strTable, type, strSQLName, strSchema, strSourceName, strNamespace,
+                                                              strSrcPath, strSQLPath, strTabDenotation))->second;
+      std::get<9>(table.data) = texts.Store(snapshot.View());
+      std::get<10>(table.data) = texts.Store(snapshot.View());
+      auto const boOwnContainer = snapshot.Get<bool>();
+      auto const container_type = snapshot.Get<EMyContainerType>();
+      if (boOwnContainer) table.OwnContainerType(container_type);
+
+      auto& attributes = table.Attributes();
+      auto const iAttributes = snapshot.Get<size_t>();
+      attributes.reserve(iAttributes);
+      for (size_t iAttr = 0; iAttr < iAttributes; ++iAttr) {
+         auto const iID = snapshot.Get<int>();
+         auto strAttrName = snapshot.Text();
+         auto strDBName = snapshot.Text();
+         auto strAttrDataType = snapshot.Text();
+         auto const iLen = snapshot.Get<size_t>();
+         auto const iScale = snapshot.Get<size_t>();
+         auto const boNotNull = snapshot.Get<bool>();
+         auto const boPrimary = snapshot.Get<bool>();
+         auto strAttrCheck = snapshot.Text();
+         auto const check_kind = snapshot.Get<EMyCheckKinds>();
+         auto strInit = snapshot.Text();
+         auto strComputed = snapshot.Text();
+         auto const calc_kind = snapshot.Get<EMyCalculationKinds>();
+         auto strAttrDenotation = snapshot.Text();
+         auto& attr = attributes.emplace_back(table, iID, strAttrName, strDBName, strAttrDataType, iLen, iScale, boNotNull, boPrimary,
+                                              strAttrCheck, check_kind, strInit, strComputed, calc_kind, strAttrDenotation);
+         std::get<14>(attr.data) = texts.Store(snapshot.View());
+         std::get<15>(attr.data) = texts.Store(snapshot.View());
+         }
+
+      auto& references = table.References();
+      auto const iReferences = snapshot.Get<size_t>();
+      references.reserve(iReferences);
+      for (size_t iRef = 0; iRef < iReferences; ++iRef) {
+         auto strRefName = snapshot.Text();
+         auto const ref_type = snapshot.Get<EMyReferenceType>();
+         auto strRefTable = snapshot.Text();
+         auto const strRefDescription = texts.Store(snapshot.View());
+         auto strCardinality = snapshot.Text();
+         auto const boShowAttribute = snapshot.Get<bool>();
+         auto const iShowAttribute = snapshot.Get<size_t>();
+         auto const strRefComment = texts.Store(snapshot.View());
+         std::vector<std::pair<size_t, size_t>> values(snapshot.Get<size_t>());
+         for (auto& [attr, ref_attr] : values) { attr = snapshot.Get<size_t>(); ref_attr = snapshot.Get<size_t>(); }
+         references.emplace_back(table, strRefName, ref_type, strRefTable, strRefDescription, strCardinality,
+                                 boShowAttribute ? std::optional<size_t> { iShowAttribute } : std::nullopt, strRefComment, std::move(values));
+         }
+
+      auto& indices = table.Indices();
+      auto const iIndices = snapshot.Get<size_t>();
+      indices.reserve(iIndices);
+      for (size_t iIdx = 0; iIdx < iIndices; ++iIdx) {
+         auto strIdxName = snapshot.Text();
+         auto const idx_type = snapshot.Get<EMyIndexType>();
+         auto strIdxComment = snapshot.Text();
+         std::vector<std::pair<size_t, bool>> values(snapshot.Get<size_t>());
+         for (auto& [attr, boAsc] : values) { attr = snapshot.Get<size_t>(); boAsc = snapshot.Get<bool>(); }
+         indices.emplace_back(table, strIdxName, idx_type, strIdxComment, std::move(values));
+         }
+
+      table.RangeValues() = snapshot.Statements();
+      table.PostConditions() = snapshot.Statements();
+      table.Cleanings() = snapshot.Statements();
+      }
+
+   if (!snapshot.AtEnd()) [[unlikely]] throw std::runtime_error("snapshot \""s + strFile + "\" has unexpected data at the end."s);
+   Unlink();
+   Link();
+   return true;
+   }
@@ -15,7 +15,7 @@ namespace fs = std::filesystem;
 using namespace std::string_literals;
 
 
-inline std::string toHTML(const std::string& input) {
+inline std::string toHTML(std::string_view input) {
    std::string output;
    std::ranges::for_each(input, [&output](char c) {
       switch (c) {
@@ -79,7 +79,7 @@ void TMyDictionary::Create_Doxygen(std::ostream& os) const {
 
    std::ranges::for_each(Tables(), [&os](auto const val) { 
                   os << std::format("\\include{{doc}} {}/{}.dox\n", std::get<1>(val).SrcPath(), std::get<1>(val).Name()); });
-   os << std::format("\\include{{doc}} {}/{}.dox\n", "sql"s, Identifier() + "_sql"s);
+   out_format(os, "\\include{{doc}} {}/{}.dox\n", "sql"s, Identifier() + "_sql"s);
 
    if(!namespaces.empty()) {
       for(auto const& [_, nsp] : namespaces) {
@@ -315,7 +315,7 @@ void TMyDictionary::Create_Doxygen(std::ostream& os) const {
       std::ranges::for_each(Tables(), [&os, &strGraphFmt](auto const& pair) {
            TMyTable const& table = std::get<1>(pair);
            std::ranges::for_each(table.References(), [&os, &table, &strGraphFmt](auto const& ref) {
-                 TMyTable const& refTable = table.Dictionary().FindTable(ref.RefTable());
+                 TMyTable const& refTable = ref.GetRefTable();
                  os << "   " << table.Name() << " -- " << ref.Name() << " [" << strGraphFmt << "];\n";
                  os << "   " << ref.Name() << " -- " << refTable.Name() << " [" << strGraphFmt << "];\n";
                  });
@@ -326,7 +326,7 @@ void TMyDictionary::Create_Doxygen(std::ostream& os) const {
       std::ranges::for_each(Tables(), [&os, &strGraphFmt, &strGraphLabelFmt](auto const& pair) {
          TMyTable const& table = std::get<1>(pair);
          std::ranges::for_each(table.References(), [&os, &table, &strGraphFmt, &strGraphLabelFmt](auto const& ref) {
-            TMyTable const& refTable = table.Dictionary().FindTable(ref.RefTable());
+            TMyTable const& refTable = ref.GetRefTable();
             auto cardinality = processString(ref.Cardinality());
             os << "   " << table.Name() << " -- " << refTable.Name()    // 
                << " [label=\"" << ref.Description() << "\", " 
@@ -374,7 +374,7 @@ void TMyDictionary::Create_Doxygen(std::ostream& os) const {
          << "<tr><th colspan=\"11\">description\n"
          << "</tr>\n";
       for (auto const& attr : table.Attributes()) {
-         auto const& datatype = attr.Table().Dictionary().FindDataType(attr.DataType());
+         auto const& datatype = attr.GetDataType();
          os << "<tr><td rowspan=\"2\" valign =\"top\">" << attr.Name() << '\n'
             << "    <td valign = \"top\"><a href =\"#datatyp_" << attr.DataType() << "\">" << attr.DataType() << "</a>\n"
             << "    <td valign = \"top\">" << datatype.DatabaseType() << '\n';
@@ -415,7 +415,7 @@ void TMyDictionary::Create_Doxygen(std::ostream& os) const {
             << "</tr>\n";
 
          for(auto const& reference : table.References()) {
-            TMyTable const& refTable = table.Dictionary().FindTable(reference.RefTable());
+            TMyTable const& refTable = reference.GetRefTable();
             os << "<tr><td valign =\"top\">" << reference.ReferenceTypeTxt() << '\n'
                << "    <td valign =\"top\">" << reference.Description() << '\n'
                << "    <td valign =\"top\"> \\ref " << refTable.Doc_RefName() << '\n'
@@ -576,7 +576,7 @@ bool TMyTable::CreateDox(std::ostream& os) const {
          << "<table>\n"
          << "<tr><th>class</th><th>table</th><th>file</th></tr>\n";
 
-      std::ranges::for_each(parents, [this, &os](auto const& p) {
+      std::ranges::for_each(parents, [this, &os](TMyTable const& p) {
          os << "<tr><td>" << p.FullClassName() << "</td>"
             << "    <td>\\ref " << p.Doc_RefName() << "</td>"
             << "    <td>" << (p.SrcPath().size() > 0 ? p.SrcPath() + "/"s : ""s) + p.SourceName() + ".h</td></tr>";
@@ -604,13 +604,13 @@ bool TMyTable::CreateDox(std::ostream& os) const {
             << "    <td rowspan=\"" << vecParams.size() << "\">\\ref " << table.Doc_RefName() << "</td>\n";
          auto const& attr1 = table.FindAttribute(vecParams[0].first);
          auto const& attr2 = table.FindAttribute(vecParams[0].second);
-         os << "    <td>" << attr1.Name() << "(" << Dictionary().FindDataType(attr1.DataType()).SourceType() << ")" << "</td>\n"
-            << "    <td>" << attr2.Name() << "(" << Dictionary().FindDataType(attr2.DataType()).SourceType() << ")" << "</td>\n";
+         os << "    <td>" << attr1.Name() << "(" << attr1.GetDataType().SourceType() << ")" << "</td>\n"
+            << "    <td>" << attr2.Name() << "(" << attr2.GetDataType().SourceType() << ")" << "</td>\n";
          int i = 0;
          os << "    <td rowspan=\"" << vecParams.size() << "\">";
          std::ranges::for_each(vecKeys, [&os, &table, &vecKeys, &i, this](auto const& k) {
             auto const& attr = table.FindAttribute(k);
-            os << (i++ > 0 ? ", " : "") << attr.Name() << "(" << Dictionary().FindDataType(attr.DataType()).SourceType() << ")";
+            os << (i++ > 0 ? ", " : "") << attr.Name() << "(" << attr.GetDataType().SourceType() << ")";
             });
          os << "</td>\n"
             << "    <td rowspan=\"" << vecParams.size() << "\">"
@@ -618,8 +618,8 @@ bool TMyTable::CreateDox(std::ostream& os) const {
          std::ranges::for_each(vecParams | std::views::drop(1), [&os, &table, this](auto const& p) {
             auto const& attr1 = table.FindAttribute(p.first);
             auto const& attr2 = table.FindAttribute(p.second);
-            os << "    <td>" << attr1.Name() << "(" << Dictionary().FindDataType(attr1.DataType()).SourceType() << ")" << "</td>"
-               << "    <td>" << attr2.Name() << "(" << Dictionary().FindDataType(attr2.DataType()).SourceType() << ")" << "</td>";
+            os << "    <td>" << attr1.Name() << "(" << attr1.GetDataType().SourceType() << ")" << "</td>"
+               << "    <td>" << attr2.Name() << "(" << attr2.GetDataType().SourceType() << ")" << "</td>";
             });
       
          }
@@ -636,6 +636,7 @@ bool TMyTable::CreateDox(std::ostream& os) const {
 
    // helping class for primary key
    auto prim_attr = processing_data | std::views::filter([](auto const& a) { return std::get<0>(a).Primary(); }) | std::ranges::to<std::vector>();
+   bool const boPackedKey = PackedKey();
 
    os << "\\class " << FullyQualifiedSourceName() << "::primary_key\n"
       << "\\brief primary key for elements of the class " << FullyQualifiedSourceName() << " in a container "
@@ -652,6 +653,16 @@ bool TMyTable::CreateDox(std::ostream& os) const {
       << "\\brief move constructor for the class " << FullyQualifiedSourceName() << "::primary_key\n"
       << "\\param [in] other primary_key&& with the instance which values should be occupied and moved to this instance\n"
       << "\n"
+      << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator = (primary_key const& other)\n"
+      << "\\brief copy assignment for the class " << FullyQualifiedSourceName() << "::primary_key, necessary for the containers\n"
+      << "\\param [in] other primary_key const& with the instance which values should be copied\n"
+      << "\\returns reference to this instance\n"
+      << "\n"
+      << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator = (primary_key&& other)\n"
+      << "\\brief move assignment for the class " << FullyQualifiedSourceName() << "::primary_key, necessary for the containers\n"
+      << "\\param [in] other primary_key&& with the instance which values should be moved to this instance\n"
+      << "\\returns reference to this instance\n"
+      << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::primary_key(" << ClassName() << " const& other)\n"
       << "\\brief initializing constructor with an instance of the encircling class " << FullyQualifiedSourceName()
       << " for the class " << FullyQualifiedSourceName() << "::primary_key\n"
@@ -681,11 +692,11 @@ bool TMyTable::CreateDox(std::ostream& os) const {
                                                                   (std::get<1>(prim_attr[0]).UseReference() ? " const&" : ""),
                                                                    std::get<0>(prim_attr[0]).Name());
    for (auto const& [attr, dtype] : prim_attr | std::views::drop(1))
-      os << std::format(", {0}{1} p{2}", dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Name());
+      out_format(os, ", {0}{1} p{2}", dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Name());
    os << ")\n"
       << "\\brief initializing constructor with the values for key attributes of the primary_key class\n";
    for (auto const& [attr, dtype] : prim_attr) {
-      os << std::format("\\param [in] p{0} {1} {2} with {3}\n", attr.Name(), dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Denotation());
+      out_format(os, "\\param [in] p{0} {1} {2} with {3}\n", attr.Name(), dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Denotation());
       }
    os << "\n";
    for (auto const& [attr, dtype] : prim_attr) {
@@ -726,7 +737,27 @@ bool TMyTable::CreateDox(std::ostream& os) const {
       << FullyQualifiedSourceName() << "::primary_key" << "\n"
       << "\\returns reference to the std::ostream to continue writing after call of this function\n\n";
 
+   // hash value for the unordered containers
+   os << "\\fn " << FullyQualifiedSourceName() << "::primary_key::hash() const\n"
+      << "\\brief hash value of the primary key for unordered containers, used by std::hash<" << FullyQualifiedSourceName() << "::primary_key>\n"
+      << (boPackedKey ? "\\details the packed integers of the key attributes (primary_key::_packed()) are mixed into the hash value.\n"s
+                      : "\\details the values of the key attributes are mixed into the hash value in the sequence of the dictionary.\n"s)
+      << "\\returns std::size_t with the hash value of this instance\n\n";
+
    // relational operators for the key class
+   std::string const strCompare = boPackedKey ?
+         "\\details all attributes of the key are integral, this operator compares the packed integers of the key "
+         "attributes (primary_key::_packed()), this keeps the sequence of the members in the dictionary.\n"s :
+         "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
+         "the member in the sequence they are found in the dictionary.\n"s;
+
+   if (boPackedKey) {
+      os << "\\fn " << FullyQualifiedSourceName() << "::primary_key::_packed() const\n"
+         << "\\brief internal help function with the attributes of the key packed into one or two unsigned integers.\n"
+         << "\\details the attributes are placed in the sequence of the dictionary from the high to the low bits, "
+         << "signed values with an inverted sign bit, so the comparison of the integers keeps the sequence of the key.\n\n";
+      }
+
    os << "\\fn " << FullyQualifiedSourceName() << "::primary_key::_compare(primary_key const&) const\n"
       << "\\brief internal help function to compare the current instance with to another instance of the same class.\n"
       << "\\details the comparison is performed using a lambda function, \"comp_help\", which compares two objects and "
@@ -744,43 +775,37 @@ bool TMyTable::CreateDox(std::ostream& os) const {
       << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator == (primary_key const&) const\n"
       << "\\brief checks whether the object is equal to another object of the same primary key class.\n"
-      << "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
-      << "the member in the sequence they are found in the dictionary."
+      << strCompare
       << "\\param other a constant reference to another object of the same class primary_key.\n"
       << "\\return boolean value, true if the objects are equal, false otherwise.\n"
       << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator != (primary_key const&) const\n"
       << "\\brief checks whether the object is not equal to another object of the same class.\n"
-      << "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
-      << "the member in the sequence they are found in the dictionary."
+      << strCompare
       << "\\param other a constant reference to another object of the same class primary_key.\n"
       << "\\return boolean value, true if the objects are not equal, false otherwise.\n"
       << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator < (primary_key const&) const\n"
       << "\\brief checks whether the object is less than the other object of the same class.\n"
-      << "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
-      << "the member in the sequence they are found in the dictionary."
+      << strCompare
       << "\\param other a constant reference to another object of the same class primary_key.\n"
       << "\\return boolean value, true if the object is less than to the other object, false otherwise.\n"
       << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator <= (primary_key const&) const\n"
       << "\\brief checks whether the object is less than or equal to the other object of the same class.\n"
-      << "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
-      << "the member in the sequence they are found in the dictionary."
+      << strCompare
       << "\\param other a constant reference to another object of the same class primary_key.\n"
       << "\\return boolean value, true if the object is less than or equal to the other object, false otherwise.\n"
       << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator > (primary_key const&) const\n"
       << "\\brief checks whether the object is greater than the other object of the same class.\n"
-      << "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
-      << "the member in the sequence they are found in the dictionary."
+      << strCompare
       << "\\param other a constant reference to another object of the same class primary_key.\n"
       << "\\return boolean value, true if the object is greater than to the other object, false otherwise.\n"
       << "\n"
       << "\\fn " << FullyQualifiedSourceName() << "::primary_key::operator >= (primary_key const&) const\n"
       << "\\brief checks whether the object is greater than or equal the other object of the same class.\n"
-      << "\\details this operator use the internal function primary_key::_compare() as implemetation and compare "
-      << "the member in the sequence they are found in the dictionary."
+      << strCompare
       << "\\param other a constant reference to another object of the same class primary_key.\n"
       << "\\return boolean value, true if the object is greater than or equal to the other object, false otherwise.\n"
       << "\n";
@@ -789,8 +814,8 @@ bool TMyTable::CreateDox(std::ostream& os) const {
 
    // helping types for composed data
    os << "\\typedef " << FullyQualifiedSourceName()<< "::container_ty\n"
-      << "\\brief container type as std::map with the generated primary key type "
-      << FullyQualifiedSourceName() << "::primary_key for instances of this class\n\n"
+      << "\\brief container type as " << (ContainerType() == EMyContainerType::flat_map ? "own::flat_map (sorted vector)"s : "std::map"s)
+      << " with the generated primary key type " << FullyQualifiedSourceName() << "::primary_key for instances of this class\n\n"
       << "\\details The type uses the key type " << FullyQualifiedSourceName() << "::primary_key" 
       << "previously created from the key attributes of table \\ref " << Doc_RefName() << " as the "
       << "key_type for the container to hold values of this class as value_type.\n"
@@ -802,6 +827,24 @@ bool TMyTable::CreateDox(std::ostream& os) const {
       << "\\details you can use a sort order to read data into this container or work with this later.\n"
       << "\n";
 
+   if (Dictionary().HashContainer()) {
+      os << "\\typedef " << FullyQualifiedSourceName() << "::hash_container_ty\n"
+         << "\\brief container type as own::hash_map (open addressing) with the key type " << FullyQualifiedSourceName()
+         << "::primary_key for point lookups of instances of this class\n"
+         << "\\details the key is hashed with " << FullyQualifiedSourceName() << "::primary_key::hash(), there isn't an order of the elements.\n"
+         << "\n";
+      }
+
+   if (Dictionary().ColumnContainer()) {
+      os << "\\class " << FullyQualifiedSourceName() << "::columns_ty\n"
+         << "\\brief column container (structure of arrays) for instances of the class " << FullyQualifiedSourceName() << "\n"
+         << "\\details the container holds one vector and one validity bitmap for every direct data element of the table \\ref "
+         << Doc_RefName() << ", a scan over one attribute reads only the values of this attribute. rows are appended with "
+         << "push_back and read with a row_view or as instance of the class with get. the data elements of composed tables and "
+         << "of base classes aren't part of the container.\n"
+         << "\n";
+      }
+
    os << "\\fn " << FullyQualifiedSourceName() << "::GetKey() const\n"
       << "\\brief method to get the primary key for this instance\n"
       << "\\returns type " << FullyQualifiedSourceName() << "\n"
@@ -815,7 +858,7 @@ bool TMyTable::CreateDox(std::ostream& os) const {
          << "\\details <table><tr><th>attribute</th><th>data element</th><th>description</th></tr>\n";
       for(auto const& id : vecKeys) {
          auto const& attr  = table.FindAttribute(id);
-         auto const& dtype = Dictionary().FindDataType(attr.DataType());
+         auto const& dtype = attr.GetDataType();
          os << "<tr><td>" << attr.Name() << "</td>\n"
             << "    <td>" << table.FullyQualifiedSourceName() << "::" << dtype.Prefix() << attr.Name() << "</td>\n"
             << "    <td>" << attr.Denotation() << "</td>\n"
@@ -871,11 +914,15 @@ bool TMyTable::CreateDox(std::ostream& os) const {
 
 
    // ------------------------- write documention for all the attributs ------------------------------
+   // with EMyRecordLayout::null_bitmap the members are plain values and the selectors return copies
+   bool const boNullBitmap = Dictionary().RecordLayout() == EMyRecordLayout::null_bitmap;
    os << "\\name direct data elements from table\n"
       << "\\{\n\n";
    for (auto const& [attr, dtype] : processing_data) {
       std::string strFullAttr = FullyQualifiedSourceName() + "::"s + dtype.Prefix() + attr.Name();
-      std::string strNote1 = "Source: member "s + strFullAttr + " in class " + FullyQualifiedSourceName() + " with the type std::optional<"s + dtype.SourceType() + ">"s;
+      std::string strNote1 = "Source: member "s + strFullAttr + " in class " + FullyQualifiedSourceName() +
+                             (!boNullBitmap ? " with the type std::optional<"s + dtype.SourceType() + ">"s :
+                                              " with the type "s + dtype.SourceType() + ", valid when the bit in the null bitmap is set"s);
       std::string strNote2 = "Database: attribute \""s + attr.DBName() + "\" in entity \\ref "s + Doc_RefName() + " with database type "s + dtype.DatabaseType();
 
       // direct data elements
@@ -900,6 +947,10 @@ bool TMyTable::CreateDox(std::ostream& os) const {
          }
       os << "\n";
       }
+   if (boNullBitmap) {
+      os << "\\var " << FullyQualifiedSourceName() << "::_present\n"
+         << "\\brief null bitmap, a set bit for every data element with a value in the sequence of the table\n\n";
+      }
    os << "\n";
    os << "\\}\n\n";
 
@@ -913,10 +964,11 @@ bool TMyTable::CreateDox(std::ostream& os) const {
       std::string strFullFunc1 = FullyQualifiedSourceName() + "::"s + attr.Name();  // Name for Selectors, Manipulators as "Property"
       std::string strRetVal = "std::optional<"s + dtype.SourceType() + ">"s;
 
-      os << "\\fn " << strRetVal << " const& " << strFullFunc1 << "() const\n";
+      os << "\\fn " << strRetVal << (!boNullBitmap ? " const& "s : " "s) << strFullFunc1 << "() const\n";
       os << "\\brief selector for the data element " << strFullAttr << '\n';
       if (attr.Denotation().size() > 0) os << "\\details <b>" << attr.Denotation() << "</b>\n";
-      os << "\\returns " << strRetVal << " const&: Reference to the data element " << strFullAttr << '\n';
+      if (!boNullBitmap) os << "\\returns " << strRetVal << " const&: Reference to the data element " << strFullAttr << '\n';
+      else os << "\\returns " << strRetVal << ": copy of the data element " << strFullAttr << ", std::nullopt when the bit in the null bitmap isn't set\n";
       }
    os << "\n";
    os << "\\}\n\n";
@@ -951,11 +1003,12 @@ bool TMyTable::CreateDox(std::ostream& os) const {
          std::string strFullFunc1 = FullyQualifiedSourceName() + "::"s + attr.Name();  // Name for Selectors, Manipulators as "Property"
          std::string strRetVal = "std::optional<"s + dtype.SourceType() + ">"s;
 
-         os << "\\fn " << strRetVal << " const& " << strFullFunc1 << "(" << strRetVal << " const& newVal)\n";
+         os << "\\fn " << strRetVal << (!boNullBitmap ? " const& "s : " "s) << strFullFunc1 << "(" << strRetVal << " const& newVal)\n";
          os << "\\brief manipulator for the data element " << strFullAttr << '\n';
          if (attr.Denotation().size() > 0) os << "\\details <b>" << attr.Denotation() << "</b>\n";
          os << "\\param[in] newVal the new Value for the member " << strFullAttr << '\n';
-         os << "\\returns " << strRetVal << " const&: Reference to the data element " << strFullAttr << '\n';
+         if (!boNullBitmap) os << "\\returns " << strRetVal << " const&: Reference to the data element " << strFullAttr << '\n';
+         else os << "\\returns " << strRetVal << ": the new value newVal, a NULL clears the bit in the null bitmap\n";
          os << "\n";
          }
       os << "\n";
@@ -973,11 +1026,12 @@ bool TMyTable::CreateDox(std::ostream& os) const {
          std::string strFullFunc1 = FullyQualifiedSourceName() + "::"s + attr.Name();  // Name for Selectors, Manipulators as "Property"
          std::string strRetVal = "std::optional<"s + dtype.SourceType() + ">"s;
 
-         os << "\\fn " << strRetVal << " const& " << strFullFunc1 << "(" << strRetVal << " const& newVal)\n";
+         os << "\\fn " << strRetVal << (!boNullBitmap ? " const& "s : " "s) << strFullFunc1 << "(" << strRetVal << " const& newVal)\n";
          os << "\\brief manipulator for the data element " << strFullAttr << '\n';
          if (attr.Denotation().size() > 0) os << "\\details <b>" << attr.Denotation() << "</b>\n";
          os << "\\param[in] newVal the new Value for the member " << strFullAttr << '\n';
-         os << "\\returns " << strRetVal << " const&: Reference to the data element " << strFullAttr << '\n';
+         if (!boNullBitmap) os << "\\returns " << strRetVal << " const&: Reference to the data element " << strFullAttr << '\n';
+         else os << "\\returns " << strRetVal << ": the new value newVal, a NULL clears the bit in the null bitmap\n";
          os << "\n";
          }
       os << "\n";
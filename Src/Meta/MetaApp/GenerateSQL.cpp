@@ -17,7 +17,6 @@
 
 #include "DataDictionary.h"
 #include "DictionaryHelper.h"
-#include "MyProperty.h"
 
 #include <fstream>
 #include <sstream>
@@ -45,6 +44,84 @@ constexpr std::string Generator_SQL::get_name_for_table(TMyTable const& table) c
    }
 
 
+// -------------------------------------------------------------------------------------------------
+// cache for the statements
+// -------------------------------------------------------------------------------------------------
+
+myStatements const& Generator_SQL::CachedStatements(TMyTable const& table, EStatementKind kind, EQueryType type, std::string_view part,
+                                                    std::function<myStatements ()> const& build) const {
+   {
+      std::shared_lock lock(mtxStatements);
+      if (auto it = statements.find(std::make_tuple(std::string_view { table.Name() }, kind, type, part)); it != statements.end()) [[likely]]
+         return it->second;
+   }
+
+   // built without lock, when another thread was faster its statements are used and these dropped
+   auto created = build();
+   std::unique_lock lock(mtxStatements);
+   return statements.try_emplace(statement_key { table.Name(), kind, type, std::string { part } }, std::move(created)).first->second;
+   }
+
+myStatements const& Generator_SQL::TableStatements(TMyTable const& table, EStatementKind kind) const {
+   return CachedStatements(table, kind, EQueryType::SelectAll, { }, [this, &table, kind]() {
+      switch (kind) {
+         case EStatementKind::create_table:     return CreateTable_Statements(table);
+         case EStatementKind::create_view:      return CreateView_Statements(table);
+         case EStatementKind::alter_table:      return AlterTable_Statements(table);
+         case EStatementKind::primary_key:      return PrimaryKey_Statements(table);
+         case EStatementKind::foreign_keys:     return ForeignKeys_Statements(table);
+         case EStatementKind::unique_keys:      return UniqueKeys_Statements(table);
+         case EStatementKind::check_conditions: return CheckConditions_Statements(table);
+         case EStatementKind::indices:          return Indices_Statements(table);
+         case EStatementKind::range_values:     return RangeValues_Statements(table);
+         case EStatementKind::post_conditions:  return PostConditions_Statements(table);
+         case EStatementKind::cleaning:         return Cleaning_Statements(table);
+         default: throw std::runtime_error(std::format("unexpected kind of statements for table {}.", table.Name()));
+         }
+      });
+   }
+
+void Generator_SQL::ClearStatements() const {
+   std::unique_lock lock(mtxStatements);
+   statements.clear();
+   }
+
+void Generator_SQL::TakeStatements(Generator_SQL const& other, std::set<std::string> const& rebuild) const {
+   if (&other == this) [[unlikely]] return;
+   std::scoped_lock lock(mtxStatements, other.mtxStatements);
+   for (auto it = other.statements.begin(); it != other.statements.end(); ) {
+      if (auto const& name = std::get<0>(it->first); rebuild.contains(name) || !dictionary.Tables().contains(name)) ++it;
+      else statements.insert(other.statements.extract(it++));
+      }
+   }
+
+Generator_SQL const& Generator_SQL::PrepareStatements(TMyTable const& table) const {
+   if (table.EntityType() == EMyEntityType::view) TableStatements(table, EStatementKind::create_view);
+   else {
+      for (auto kind : { EStatementKind::create_table, EStatementKind::alter_table, EStatementKind::primary_key, EStatementKind::foreign_keys,
+                         EStatementKind::unique_keys, EStatementKind::check_conditions, EStatementKind::indices,
+                         EStatementKind::range_values, EStatementKind::post_conditions, EStatementKind::cleaning }) {
+         TableStatements(table, kind);
+         }
+      QueryStatements<EQueryType::Insert>(table);
+      QueryStatements<EQueryType::UpdateAll>(table);
+      QueryStatements<EQueryType::UpdateWithoutPrims>(table);
+      QueryStatements<EQueryType::DeleteAll>(table);
+      QueryStatements<EQueryType::DeletePrim>(table);
+      }
+
+   QueryStatements<EQueryType::SelectAll>(table);
+   QueryStatements<EQueryType::SelectPrim>(table);
+   for (auto const& idx : table.Indices() | own::views::is_unique_key) QueryStatements<EQueryType::SelectUnique>(table, idx);
+   for (auto const& idx : table.Indices() | own::views::is_index) QueryStatements<EQueryType::SelectIdx>(table, idx);
+   for (auto const& ref : table.References()) {
+      QueryStatements<EQueryType::SelectRelation>(table, ref);
+      QueryStatements<EQueryType::SelectRevRelation>(table, ref);
+      }
+   return *this;
+   }
+
+
 Generator_SQL const& Generator_SQL::WriteCreateTable(TMyTable const& table, fs::path file) const {
    std::ofstream ofs(file);
    if (!ofs) throw std::runtime_error(std::format("error while writing create statements for table {} in file {}.",
@@ -54,7 +131,7 @@ Generator_SQL const& Generator_SQL::WriteCreateTable(TMyTable const& table, fs::
 
 
 Generator_SQL const& Generator_SQL::WriteCreateTable(TMyTable const& table, std::ostream &os) const {
-   if (auto statements = CreateTable_Statements(table); statements.size() > 0) [[likely]] {
+   if (auto const& statements = TableStatements(table, EStatementKind::create_table); statements.size() > 0) [[likely]] {
       os << "-- statement to create the table " << table.FullyQualifiedSQLName() << '\n';
       std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
       os << '\n';
@@ -67,7 +144,7 @@ Generator_SQL const& Generator_SQL::WriteCreateTable(TMyTable const& table, std:
 
 Generator_SQL const& Generator_SQL::WriteCreateView(TMyTable const& table, std::ostream& os) const {
    os << "-- statement to create the view " << table.FullyQualifiedSQLName() << '\n';
-   auto statements = CreateView_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::create_view);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -75,7 +152,7 @@ Generator_SQL const& Generator_SQL::WriteCreateView(TMyTable const& table, std::
 
 Generator_SQL const& Generator_SQL::WriteAlterTable(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- alter table for table ... 
-   auto statements = AlterTable_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::alter_table);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if(statements.size() > 0) os << '\n';
    return *this;
@@ -84,7 +161,7 @@ Generator_SQL const& Generator_SQL::WriteAlterTable(TMyTable const& table, std::
 
 Generator_SQL const& Generator_SQL::WritePrimaryKey(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- create primary key for table ... 
-   auto statements = PrimaryKey_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::primary_key);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -92,7 +169,7 @@ Generator_SQL const& Generator_SQL::WritePrimaryKey(TMyTable const& table, std::
 
 Generator_SQL const& Generator_SQL::WriteForeignKeys(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- create foreign keys for table ... 
-   auto statements = ForeignKeys_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::foreign_keys);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -100,7 +177,7 @@ Generator_SQL const& Generator_SQL::WriteForeignKeys(TMyTable const& table, std:
 
 Generator_SQL const& Generator_SQL::WriteUniqueKeys(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- create unique keys for table ... 
-   auto statements = UniqueKeys_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::unique_keys);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -108,7 +185,7 @@ Generator_SQL const& Generator_SQL::WriteUniqueKeys(TMyTable const& table, std::
 
 Generator_SQL const& Generator_SQL::WriteCreateIndices(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- create indices for table ... 
-   auto statements = Indices_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::indices);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -116,7 +193,7 @@ Generator_SQL const& Generator_SQL::WriteCreateIndices(TMyTable const& table, st
 
 Generator_SQL const& Generator_SQL::WriteCreateCheckConditions(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- create check conditions for table ...
-   auto statements = CheckConditions_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::check_conditions);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -124,7 +201,7 @@ Generator_SQL const& Generator_SQL::WriteCreateCheckConditions(TMyTable const& t
 
 Generator_SQL const& Generator_SQL::WriteRangeValues(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- insert range values for table ...
-   auto statements = RangeValues_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::range_values);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -134,7 +211,7 @@ Generator_SQL const& Generator_SQL::WriteRangeValues(TMyTable const& table, std:
 /// \notes there can be a go before needed
 Generator_SQL const& Generator_SQL::WriteCreatePostConditions(TMyTable const& table, std::ostream& os) const {
    // possibly add a comment -- insert range values for table ...
-   auto statements = PostConditions_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::post_conditions);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << "\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -142,7 +219,7 @@ Generator_SQL const& Generator_SQL::WriteCreatePostConditions(TMyTable const& ta
 
 Generator_SQL const& Generator_SQL::WriteCreateCleaning(TMyTable const& table, std::ostream& os) const {
    // possible comment 
-   auto statements = Cleaning_Statements(table);
+   auto const& statements = TableStatements(table, EStatementKind::cleaning);
    std::ranges::for_each(statements, [&os](auto const& p) { os << p << ";\n"; });
    if (statements.size() > 0) os << '\n';
    return *this;
@@ -158,10 +235,10 @@ Generator_SQL const& Generator_SQL::WriteDescriptions(TMyTable const& table, std
 
 
 std::string Generator_SQL::CreateTable_SQLRow(TMyTable const& table, TMyAttribute const& attr, size_t len) const {
-   auto const& datatype = table.Dictionary().FindDataType(attr.DataType());
+   auto const& datatype = attr.GetDataType();
    std::ostringstream os;
    if (!attr.IsComputed()) [[likely]] {
-      os << std::format("   {:<{}} {}", attr.DBName(), len, datatype.DatabaseType());
+      out_format(os, "   {:<{}} {}", attr.DBName(), len, datatype.DatabaseType());
       if (datatype.UseLen()) {
          os << "(" << attr.Len();
          if (datatype.UseScale()) os << ", " << attr.Scale() << ")";
@@ -194,15 +271,15 @@ std::string  Generator_SQL::SQLRow(TMyTable const& table, TMyReferences const& r
    std::string strSQL;
    std::ostringstream sList1, sList2;
 
-   TMyTable const& ref = reference.Table().Dictionary().FindTable(reference.RefTable());
+   TMyTable const& ref = reference.GetRefTable();
 
    sList1 << "(";
    sList2 << "(";
    int i = 0;
-   std::ranges::for_each(reference.Values(), [&reference, &ref, &sList1, &sList2, &i](auto const& row) {
-                       sList1 << (i > 0 ? ", " : "") << reference.Table().FindAttribute(row.first).DBName();
-                       sList2 << (i++ > 0 ? ", " : "") << ref.FindAttribute(row.second).DBName();
-                       });
+   for (auto const& [attribute, ref_attribute] : reference.JoinedAttributes()) {
+      sList1 << (i > 0 ? ", " : "") << attribute.DBName();
+      sList2 << (i++ > 0 ? ", " : "") << ref_attribute.DBName();
+      }
    sList1 << ")";
    sList2 << ")";
 
@@ -319,8 +396,8 @@ myStatements Generator_SQL::UniqueKeys_Statements(TMyTable const& table) const {
 
 myStatements Generator_SQL::CheckConditions_Statements(TMyTable const& table) const {
    if (table.EntityType() == EMyEntityType::view) return { };
-   else return table.Attributes() | std::views::transform([&table](auto const& attr) {
-                                           return std::make_pair(attr, table.Dictionary().FindDataType(attr.DataType())); })
+   else return table.Attributes() | std::views::transform([](auto const& attr) {
+                                           return std::make_pair(attr, attr.GetDataType()); })
                                   | std::views::filter([](auto const& data) {
                                            return (data.first.CheckSeq().size() > 0 && 
                                                    data.first.CheckAtTable() == EMyCheckKinds::table); })
@@ -369,27 +446,40 @@ myStatements Generator_SQL::CreateView_Statements(TMyTable const& table) const {
 //  NEW DEFINITION FOR FUNCTIONS WHICH CREATE SQL STATEMENTS
 // =====================================================================================================================
 
-using attr_filter_func = std::function<bool(TMyAttribute const&)>;
-
 enum class Attr_Mode : uint32_t { undefined, none, assign, like };
 
-//myStatements, stream, prefix, intro, first, follow, separator, Abschluss, lnge, zuweisung, function
-//                                0                1                 2            3            4            5        
-using part_data = std::tuple<myStatements, std::ostringstream, std::string, std::string, std::string, std::string, 
-//                                6           7         8        9            10
-                             std::string, std::string, size_t, Attr_Mode, attr_filter_func>;
-
-auto part_detail = [](attr_filter_func f, int l, Attr_Mode m, std::string&& p1, std::string&& p2, std::string&& p3, std::string&& p4, std::string&& p5, std::string&& p6) {
-   return part_data{ myStatements {}, std::ostringstream {}, p1, p2, p3, p4, p5, p6, (l < 0 ? 0u : static_cast<size_t>(l)), m, f };
+/// \brief part of a statement (select list, from, where, ...), the rule for the attributes and the filter are template parameters
+template <Attr_Mode mode, typename filter_ty>
+struct statement_part {
+   static_assert(mode != Attr_Mode::undefined, "undefined rule for attribute line");
+   filter_ty   filter;     ///< selection of the attributes for this part
+   size_t      iMaxLine;   ///< length of a line, when exceeded the next attribute starts a new line
+   std::string prefix;     ///< prefix for the parameters
+   std::string intro;      ///< own line in front of the part
+   std::string first;      ///< text in front of the first attribute
+   std::string follow;     ///< text in front of an attribute in a new line
+   std::string separator;  ///< separator between the attributes
+   std::string closer;     ///< text behind the last attribute when the part has more than one
    };
 
+template <Attr_Mode mode, typename filter_ty>
+statement_part<mode, filter_ty> part_detail(filter_ty filter, int l, std::string&& p1, std::string&& p2, std::string&& p3, std::string&& p4, std::string&& p5, std::string&& p6) {
+   return { std::move(filter), (l < 0 ? 0u : static_cast<size_t>(l)), std::move(p1), std::move(p2), std::move(p3), std::move(p4), std::move(p5), std::move(p6) };
+   }
+
+
+/// \brief attribute with the name of the parameter for a statement, without a copy of the attribute
+struct attr_with_param {
+   TMyAttribute const* attribute;
+   std::string const*  parameter;
+   };
 
-using myAttrWithParam = std::vector<std::tuple<TMyAttribute, std::string>>;
+using myAttrWithParam = std::vector<attr_with_param>;
 
 template <typename ty>
 concept AttributeValue = requires(ty t) {
    requires std::is_same_v<ty, TMyAttribute> ||
-            std::is_same_v<ty, std::tuple<TMyAttribute, std::string>>;
+            std::is_same_v<ty, attr_with_param>;
    };
 
 template<typename ty>
@@ -402,149 +492,103 @@ template<typename ty>
 concept AttributeContainer = requires(ty t) {
    typename ty::value_type;  
    requires  std::is_same_v<typename ty::value_type, TMyAttribute> ||
-            (std::is_same_v<std::tuple_element_t<0, typename ty::value_type>, TMyAttribute> &&
-             std::is_convertible_v<std::tuple_element_t<1, typename ty::value_type>, std::string>);
+             std::is_same_v<typename ty::value_type, attr_with_param>;
    };
 
-template <size_t SIZE>
-myStatements CreateStatement(std::array<part_data, SIZE>& parts, AttributeContainer auto const& all_attributes) {
-   static_assert(SIZE != 0, "invalid specification of SIZE");
+template <AttributeValue value_ty>
+TMyAttribute const& attribute_of(value_ty const& value) {
+   if constexpr (std::is_same_v<value_ty, TMyAttribute>) return value;
+   else return *value.attribute;
+   }
 
-   using attr_only_func = std::function<std::string(std::string const&/*prefix*/, std::string const& /*attribute*/, size_t /*width*/)>;
-   using attr_para_func = std::function<std::string(std::string const&/*prefix*/, std::string const& /*attribute*/, std::string const& /*paramter*/, size_t /*width*/)>;
-   using attr_func = attr_para_func; // std::variant<attr_only_func, attr_para_func>;
-   
-   static std::map<Attr_Mode, attr_func> attr_rules = {
-         { Attr_Mode::undefined, [](std::string const&, std::string const&, std::string const& , size_t) -> std::string {
-                                                 throw std::runtime_error("undefined rule for attribute line");
-                                                 }
-         },
-         { Attr_Mode::none,      [](std::string const& prefix, std::string const& attribute, std::string const& parameter, size_t width) -> std::string {
-                                                 return std::format("{0:}{1:<{2}}", prefix, attribute, width);
-                                                 } 
-         },
-         { Attr_Mode::assign,    [](std::string const& prefix, std::string const& attribute, std::string const& parameter, size_t width) -> std::string {
-                                                 return std::format("{1:<{3}} = {0:}{2:}", prefix, attribute, parameter, width);
-                                                 } 
-         },
-         { Attr_Mode::like,      [](std::string const& prefix, std::string const& attribute, std::string const& parameter, size_t width) -> std::string {
-                                                 return std::format("{1:<{3}} LIKE {0:}{2:}", prefix, attribute, parameter, width);
-                                                 } 
-         }
-      };
+/// \brief name of the parameter, the db name of the attribute or the joined name
+template <AttributeValue value_ty>
+std::string const& parameter_of(value_ty const& value) {
+   if constexpr (std::is_same_v<value_ty, TMyAttribute>) return value.DBName();
+   else return *value.parameter;
+   }
 
-   if (all_attributes.size() == 0) [[unlikely]] return { };
+/// \brief append the attribute with the rule of the mode, like is used only for datatypes which support it
+template <Attr_Mode mode>
+void append_attribute(std::string& line, std::string const& prefix, TMyAttribute const& attr, std::string const& parameter, size_t width) {
+   if constexpr (mode == Attr_Mode::none) {
+      line += prefix;
+      line += attr.DBName();
+      }
    else {
-      for (auto& part : parts) {
-         auto attributes = [&all_attributes, &part]() {
-               using used_type = std::remove_cvref_t<decltype(all_attributes)>;
-               if constexpr (AttributeOnly<used_type>) {
-                  return all_attributes | std::views::filter([&part](auto const& a) { return std::get<10>(part)(a); })
-                                        | std::ranges::to<std::vector>();
-                  }
-               else {
-                  return all_attributes | std::views::filter([&part](auto const& a) { return std::get<10>(part)(std::get<0>(a)); })
-                                        | std::ranges::to<std::vector>();
-                  }
-               }();
-
-         auto stmts  = Property([&part]() -> myStatements&       { return std::get<0>(part);  });
-         auto stream = Property([&part]() -> std::ostringstream& { return std::get<1>(part);  });
-         auto empty  = Property([&part]() -> bool                { return std::get<1>(part).str().size() == 0;  });
-         auto get    = Property([&part]() -> std::string         { std::string result = std::move(std::get<1>(part).str());
-                                                                   std::get<1>(part).str("");
-                                                                   return result; });
-         auto intro  = Property([&part]() -> std::string const&  { return std::get<3>(part);  });
-
-         size_t test = intro().size();
-         if (intro().size() > 0) stmts += std::string(intro);
-      
-         if (attributes.size() > 0) {
-            auto prefix    = [&part]() -> std::string const& { return std::get<2>(part);  };
-            auto first     = [&part]() -> std::string const& { return std::get<4>(part);  };
-            auto follow    = [&part]() -> std::string const& { return std::get<5>(part);  };
-            auto sepa      = [&part]() -> std::string const& { return std::get<6>(part);  };
-            auto closer    = [&part]() -> std::string const& { return std::get<7>(part);  };
-            auto to_long   = [&part]() -> bool               { return std::get<1>(part).str().size() > std::get<8>(part);  };
-            auto assign    = [&part]() -> Attr_Mode          { return std::get<9>(part);  };
-
-            auto rule_type = [assign](AttributeValue auto const& attr) -> Attr_Mode {
-               using used_type = std::remove_cvref_t<decltype(attr)>;
-               if constexpr (std::is_same_v<used_type, TMyAttribute>)
-                  return assign() != Attr_Mode::like ? assign() : (attr.GetDataType().WithLike() ? Attr_Mode::like : Attr_Mode::assign);
-               else
-                  return assign() != Attr_Mode::like ? assign() : (std::get<0>(attr).GetDataType().WithLike() ? Attr_Mode::like : Attr_Mode::assign);
-               };
-
-            static constexpr auto attr_param_name_impl = [](auto const& para, bool return_dbname) {
-               using value_type = std::remove_cvref_t<decltype(para)>;
-
-               if constexpr (std::is_same_v<value_type, TMyAttribute>) {
-                  return para.DBName();
-                  }
-               else if constexpr (std::is_same_v<value_type, std::tuple<TMyAttribute, std::string>>) {
-                  return return_dbname ? std::get<0>(para).DBName() : std::get<1>(para);
-                  } 
-               else static_assert(always_false<std::decay_t<decltype(para)>>, "unexpected variant for method");
-               };
-
-            static constexpr auto attr_name = [](auto const& para) {
-               return attr_param_name_impl(para, true);
-               };
-
-            static constexpr auto param_name = [](auto const& para) {
-               return attr_param_name_impl(para, false);
-               };
-
-            auto maxLengthElement = [&attributes, &to_long, &assign]() {
-                          if (to_long() == 0 && assign() != Attr_Mode::none)
-                             return std::ranges::max_element(attributes, [](auto const& a, auto const& b) {
-                                                                              return attr_name(a).size() < attr_name(b).size();
-                                                                              });
-                          else return attributes.end();
-                          }();
-
-            auto maxLengthAttr = [&attributes, &maxLengthElement]() -> size_t {
-                          if (maxLengthElement != attributes.end()) return attr_name(*maxLengthElement).size();
-                          else                        return 0u;      
-                          }();
-
-            // reducing the scope for first attribute
-            {
-               auto attr = *std::begin(attributes);
-               stream << std::format("{}{}", first(), attr_rules[rule_type(attr)](prefix(), attr_name(attr), param_name(attr), maxLengthAttr));
-            }
+      std::format_to(std::back_inserter(line), "{:<{}}", attr.DBName(), width);
+      if constexpr (mode == Attr_Mode::like) line += attr.GetDataType().WithLike() ? " LIKE "s : " = "s;
+      else line += " = "s;
+      line += prefix;
+      line += parameter;
+      }
+   }
 
-            if (attributes.size() > 1) [[likely]] {
-               for (auto const& attr : attributes | std::views::drop(1) | std::views::take(attributes.size() - 2)) {
-                  if (to_long()) {
-                     stream << sepa();
-                     stmts += get;
-                     stream << std::format("{}{}", follow(), attr_rules[rule_type(attr)](prefix(), attr_name(attr), param_name(attr), maxLengthAttr));
-                     }
-                  else [[likely]] {
-                     stream << std::format("{}{}", sepa(), attr_rules[rule_type(attr)](prefix(), attr_name(attr), param_name(attr), maxLengthAttr));
-                     }
-                  }
-
-               auto attr = attributes.back();
-               if (to_long()) {
-                  stream << sepa();
-                  stmts += get;
-                  stream << std::format("{}{}{}", follow(), attr_rules[rule_type(attr)](prefix(), attr_name(attr), param_name(attr), maxLengthAttr), closer());
-                  }
-               else {
-                  stream << std::format("{}{}{}", sepa(), attr_rules[rule_type(attr)](prefix(), attr_name(attributes.back()), param_name(attributes.back()), maxLengthAttr), closer());
-                  }
-               }
-            }
-         if(!empty) stmts += get;
-         }   
-      if constexpr (SIZE > 1) {
-         for(size_t step = 1; step < SIZE; ++step)  std::get<0>(parts[0]) += std::get<0>(parts[step]);
+/// \brief append the lines of a part to the statement, line is a reused buffer
+template <Attr_Mode mode, typename filter_ty>
+void AppendPart(myStatements& stmts, std::string& line, AttributeContainer auto const& attributes, statement_part<mode, filter_ty> const& part) {
+   if (part.intro.size() > 0) stmts.emplace_back(part.intro);
+
+   size_t count = 0, width = 0;
+   for (auto const& value : attributes) {
+      if (part.filter(attribute_of(value))) {
+         ++count;
+         if constexpr (mode != Attr_Mode::none) width = std::max(width, attribute_of(value).DBName().size());
          }
-      return std::get<0>(parts[0]);
       }
+
+   line.clear();
+   for (size_t pos = 0; auto const& value : attributes) {
+      auto const& attr = attribute_of(value);
+      if (!part.filter(attr)) continue;
+      if (pos == 0) line += part.first;
+      else if (line.size() > part.iMaxLine) {
+         line += part.separator;
+         stmts.emplace_back(line);
+         line = part.follow;
+         }
+      else [[likely]] line += part.separator;
+
+      append_attribute<mode>(line, part.prefix, attr, parameter_of(value), width);
+      if (pos > 0 && pos == count - 1) line += part.closer;
+      ++pos;
+      }
+   if (line.size() > 0) stmts.emplace_back(line);
+   }
+
+/// \brief all attributes of the table, the parameter is the db name of the joined attribute in the other table or empty
+/// \details with boReverse the table is the referenced table of the reference, the first value for an attribute wins.
+///          the attributes are matched with their ids, an attribute of another table is an error
+myAttrWithParam JoinedParameters(TMyTable const& table, TMyReferences const& ref, bool boReverse) {
+   static std::string const strNoParam;
+   auto const& attributes = table.Attributes();
+   std::vector<std::string const*> params(attributes.size(), nullptr);
+   for (auto const& [attribute, ref_attribute] : ref.JoinedAttributes()) {
+      auto const& own   = boReverse ? ref_attribute : attribute;
+      auto const& other = boReverse ? attribute : ref_attribute;
+      if (own.Table().Name() != table.Name()) [[unlikely]]
+         throw std::runtime_error(std::format("attribute {} of reference {} isn't part of table {}.", own.Name(), ref.Name(), table.Name()));
+      if (auto& param = params[&table.FindAttribute(own.ID()) - attributes.data()]; !param) param = &other.DBName();
+      }
+
+   myAttrWithParam used_attributes;
+   used_attributes.reserve(attributes.size());
+   for (size_t pos = 0; pos < attributes.size(); ++pos) {
+      used_attributes.push_back({ &attributes[pos], params[pos] ? params[pos] : &strNoParam });
+      }
+   return used_attributes;
+   }
+
+/// \brief create the statement from the parts, all parts together, empty when there are no attributes
+template <typename... parts_ty>
+myStatements CreateStatement(AttributeContainer auto const& all_attributes, parts_ty const&... parts) {
+   static_assert(sizeof...(parts_ty) != 0, "invalid specification of parts");
+   if (all_attributes.size() == 0) [[unlikely]] return { };
+
+   myStatements stmts;
+   std::string  line;
+   (AppendPart(stmts, line, all_attributes, parts), ...);
+   return stmts;
    }
 
 
@@ -552,12 +596,10 @@ myStatements Generator_SQL::CreateSelectAll_Statement(TMyTable const& table) con
    auto GetAll  = [](TMyAttribute const& a) -> bool { return true;  };
    auto GetNone = [](TMyAttribute const& a) -> bool { return false;  };
 
-   std::array<part_data, 2> parts{
-          part_detail(GetAll,  60, Attr_Mode::none, ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
-          part_detail(GetNone, 60, Attr_Mode::none, ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ","s, ""s)
-      };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+          part_detail<Attr_Mode::none>(GetAll, 60, ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
+          part_detail<Attr_Mode::none>(GetNone, 60, ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ","s, ""s)
+        );
    }
 
 myStatements Generator_SQL::CreateSelectPrim_Statement(TMyTable const& table) const {
@@ -565,13 +607,11 @@ myStatements Generator_SQL::CreateSelectPrim_Statement(TMyTable const& table) co
    auto GetNone = [](TMyAttribute const& a) -> bool { return false;  };
    auto GetPrim = [](TMyAttribute const& a) -> bool { return a.Primary();  };
 
-   std::array<part_data, 3> parts{
-        part_detail(GetAll,  60, Attr_Mode::none,   ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
-        part_detail(GetNone, 60, Attr_Mode::none,   ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetPrim,  0, Attr_Mode::assign, ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
-      };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+        part_detail<Attr_Mode::none>(GetAll, 60,   ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
+        part_detail<Attr_Mode::none>(GetNone, 60,   ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::assign>(GetPrim, 0, ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
+        );
    }
 
 myStatements Generator_SQL::CreateSelectUniqueKey_Statement(TMyTable const& table, TMyIndices const& idx) const {
@@ -589,13 +629,11 @@ myStatements Generator_SQL::CreateSelectUniqueKey_Statement(TMyTable const& tabl
                                                                              return a.Name() == c.Name();
                                                                              }) != idx_lst.end();  };
 
-   std::array<part_data, 3> parts{
-        part_detail(GetAll,  60, Attr_Mode::none,    ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
-        part_detail(GetNone, 60, Attr_Mode::none,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetIdx,   0, Attr_Mode::assign,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
-   };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+        part_detail<Attr_Mode::none>(GetAll, 60,    ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
+        part_detail<Attr_Mode::none>(GetNone, 60,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::assign>(GetIdx, 0,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
+        );
 }
 
 
@@ -616,34 +654,16 @@ myStatements Generator_SQL::CreateSelectIndex_Statement(TMyTable const& table, T
       return a.Name() == c.Name();
       }) != idx_lst.end();  };
 
-   std::array<part_data, 3> parts{
-        part_detail(GetAll,  60, Attr_Mode::none,    ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
-        part_detail(GetNone, 60, Attr_Mode::none,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetIdx,   0, Attr_Mode::like,   ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
-      };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+        part_detail<Attr_Mode::none>(GetAll, 60,    ""s,  ""s, "SELECT "s,  "       "s, ","s, ""s),
+        part_detail<Attr_Mode::none>(GetNone, 60,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::like>(GetIdx, 0,   ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
+        );
    }
 
 myStatements Generator_SQL::CreateSelectReference_Statement(TMyTable const& table, TMyReferences const& ref) const {
    auto const& refVals = ref.Values();
-   auto const& refAttr = table.Dictionary().FindTable(ref.RefTable()).Attributes();
-   
-   auto used_attributes = table.Attributes() 
-                          | std::views::transform([&ref, &refVals, refAttr](auto a) -> std::tuple<TMyAttribute, std::string> {
-                               if(auto it = std::ranges::find_if(refVals, [a](auto p) { return std::get<0>(p) == a.ID(); }); it != refVals.end()) {
-                                  if (auto it1 = std::ranges::find_if(refAttr, [&ref, &a, &it](auto ra) { return ra.ID() == std::get<1>(*it); }); it1 != refAttr.end()) {
-                                     return std::make_tuple(a, it1->DBName());
-                                     }
-                                   else {
-                                      throw std::runtime_error("unexpected combination in reference in ref "s + ref.Name());
-                                      }
-                                   }
-                               else {
-                                  return std::make_tuple(a, ""s);
-                                  }
-                               })
-                          | std::ranges::to<std::vector>();
+   auto used_attributes = JoinedParameters(table, ref, false);
 
    auto vals = refVals | own::views::first | std::ranges::to<std::vector>();
 
@@ -656,36 +676,18 @@ myStatements Generator_SQL::CreateSelectReference_Statement(TMyTable const& tabl
 
 
 
-   std::array<part_data, 3> parts{
-        part_detail(GetAll,  60, Attr_Mode::none,    ""s,  ""s, "SELECT "s,  "       "s, ", "s, ""s),
-        part_detail(GetNone, 60, Attr_Mode::none,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetRef,   0, Attr_Mode::assign,   ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
-      };
-
-   return CreateStatement(parts, used_attributes); 
+   return CreateStatement(used_attributes,
+        part_detail<Attr_Mode::none>(GetAll, 60,    ""s,  ""s, "SELECT "s,  "       "s, ", "s, ""s),
+        part_detail<Attr_Mode::none>(GetNone, 60,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::assign>(GetRef, 0,   ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
+        ); 
    }
 
 myStatements Generator_SQL::CreateSelectRevReference_Statement(TMyTable const& table, TMyReferences const& ref) const {
    auto refVals = ref.Values() | std::views::transform([](auto p) {
            return std::make_pair(std::get<1>(p), std::get<0>(p));
            });
-   auto const& refAttr = ref.Table().Attributes();
-
-   auto used_attributes = table.Attributes()
-                          | std::views::transform([&ref, &refVals, refAttr](auto a) -> std::tuple<TMyAttribute, std::string> {
-                             if(auto it = std::ranges::find_if(refVals, [a](auto p) { return std::get<0>(p) == a.ID(); }); it != refVals.end()) {
-                                if (auto it1 = std::ranges::find_if(refAttr, [&ref, &a, &it](auto ra) { return ra.ID() == std::get<1>(*it); }); it1 != refAttr.end()) {
-                                   return std::make_tuple(a, it1->DBName());
-                                   }
-                                else {
-                                   throw std::runtime_error("unexpected combination in reference in ref "s + ref.Name());
-                                   }
-                                }
-                             else {
-                                return std::make_tuple(a, ""s);
-                                }
-                             })
-                          | std::ranges::to<std::vector>();
+   auto used_attributes = JoinedParameters(table, ref, true);
 
    auto vals = refVals | own::views::first | std::ranges::to<std::vector>();
 
@@ -697,13 +699,11 @@ myStatements Generator_SQL::CreateSelectRevReference_Statement(TMyTable const& t
          }) != vals.end();  };
 
 
-   std::array<part_data, 3> parts {
-        part_detail(GetAll,  60, Attr_Mode::none,    ""s,  ""s, "SELECT "s,  "       "s, ", "s, ""s),
-        part_detail(GetNone, 60, Attr_Mode::none,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetRef,   0, Attr_Mode::like,   ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
-      };
-
-   return CreateStatement(parts, used_attributes);
+   return CreateStatement(used_attributes,
+        part_detail<Attr_Mode::none>(GetAll, 60,    ""s,  ""s, "SELECT "s,  "       "s, ", "s, ""s),
+        part_detail<Attr_Mode::none>(GetNone, 60,    ""s,  std::format("FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::like>(GetRef, 0,   ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
+        );
 }
 
 
@@ -713,12 +713,10 @@ myStatements Generator_SQL::CreateSelectRevReference_Statement(TMyTable const& t
 
 myStatements Generator_SQL::CreateInsert_Statement(TMyTable const& table) const {
    auto GetAll = [](TMyAttribute const& a) -> bool { return !a.IsComputed();  };
-   std::array<part_data, 2> parts {
-          part_detail (GetAll, 60, Attr_Mode::none, ""s,  std::format("INSERT INTO {} ", table.FullyQualifiedSQLName()), "       ("s,  "        "s, ","s, ")"s ),
-          part_detail (GetAll, 60, Attr_Mode::none, ":"s, ""s,                                                           "VALUES ("s,  "        "s, ","s, ")"s )
-          };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+          part_detail<Attr_Mode::none>(GetAll, 60, ""s,  std::format("INSERT INTO {} ", table.FullyQualifiedSQLName()), "       ("s,  "        "s, ","s, ")"s ),
+          part_detail<Attr_Mode::none>(GetAll, 60, ":"s, ""s,                                                           "VALUES ("s,  "        "s, ","s, ")"s )
+        );
    }
 
 
@@ -727,13 +725,11 @@ myStatements Generator_SQL::CreateUpdateAll_Statement(TMyTable const& table) con
    auto GetNone = [](TMyAttribute const& a) -> bool { return false;  };
    auto GetPrim = [](TMyAttribute const& a) -> bool { return a.Primary();  };
 
-   std::array<part_data, 3> parts{
-        part_detail(GetNone,  0, Attr_Mode::none,    ""s,  std::format("UPDATE {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetAll,   0, Attr_Mode::assign,  ":"s,  ""s, "SET   "s, "      "s,  ","s, ""s),
-        part_detail(GetPrim,  0, Attr_Mode::assign,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ")"s)
-        };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+        part_detail<Attr_Mode::none>(GetNone, 0,    ""s,  std::format("UPDATE {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::assign>(GetAll, 0,  ":"s,  ""s, "SET   "s, "      "s,  ","s, ""s),
+        part_detail<Attr_Mode::assign>(GetPrim, 0,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ")"s)
+        );
    }
 
 myStatements Generator_SQL::CreateUpdateWithoutPrim_Statement(TMyTable const& table) const {
@@ -741,23 +737,19 @@ myStatements Generator_SQL::CreateUpdateWithoutPrim_Statement(TMyTable const& ta
    auto GetNone   = [](TMyAttribute const& a) -> bool { return false;  };
    auto GetPrim   = [](TMyAttribute const& a) -> bool { return a.Primary();  };
 
-   std::array<part_data, 3> parts{
-        part_detail(GetNone,   0, Attr_Mode::none,    ""s,  std::format("UPDATE {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-        part_detail(GetNoPrim, 0, Attr_Mode::assign,  ":"s,  ""s, "SET   "s, "      "s,  ","s, ""s),
-        part_detail(GetPrim,   0, Attr_Mode::assign,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ")"s)
-        };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+        part_detail<Attr_Mode::none>(GetNone, 0,    ""s,  std::format("UPDATE {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+        part_detail<Attr_Mode::assign>(GetNoPrim, 0,  ":"s,  ""s, "SET   "s, "      "s,  ","s, ""s),
+        part_detail<Attr_Mode::assign>(GetPrim, 0,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ")"s)
+        );
    }
 
 
 myStatements Generator_SQL::CreateDeleteAll_Statement(TMyTable const& table) const {
    auto GetNone = [](TMyAttribute const& a) -> bool { return false;  };
-   std::array<part_data, 1> parts{
-        part_detail(GetNone, 60, Attr_Mode::none, ""s,  std::format("DELETE FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s)
-        };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+        part_detail<Attr_Mode::none>(GetNone, 60, ""s,  std::format("DELETE FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s)
+        );
    }
 
 
@@ -765,12 +757,10 @@ myStatements Generator_SQL::CreateDeletePrim_Statement(TMyTable const& table) co
    auto GetNone = [](TMyAttribute const& a) -> bool { return false;  };
    auto GetPrim = [](TMyAttribute const& a) -> bool { return a.Primary();  };
 
-   std::array<part_data, 2> parts{
-       part_detail(GetNone, 60, Attr_Mode::none,    ""s,  std::format("DELETE FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
-       part_detail(GetPrim,  0, Attr_Mode::assign,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
-      };
-
-   return CreateStatement(parts, table.Attributes());
+   return CreateStatement(table.Attributes(),
+       part_detail<Attr_Mode::none>(GetNone, 60,    ""s,  std::format("DELETE FROM {}", table.FullyQualifiedSQLName()), ""s, ""s,  ""s, ""s),
+       part_detail<Attr_Mode::assign>(GetPrim, 0,  ":key"s,  ""s, "WHERE "s, "      "s,  " AND"s, ""s)
+        );
    }
 
 
@@ -944,11 +934,11 @@ Generator_SQL const& Generator_SQL::WriteSQLDropTables(std::ostream& os) const {
 
    os << "\n-- drop all tables\n";
    for (auto const& [_, table] : Dictionary().Tables() | own::views::is_table) 
-      os << std::format("DROP TABLE {};\n", table.FullyQualifiedSQLName());
+      out_format(os, "DROP TABLE {};\n", table.FullyQualifiedSQLName());
 
    os << "\n-- drop all tables\n";
    for (auto const& [_, table] : Dictionary().Tables() | own::views::is_view)
-      os << std::format("DROP VIEW {};\n", table.FullyQualifiedSQLName());
+      out_format(os, "DROP VIEW {};\n", table.FullyQualifiedSQLName());
 
    os << "\n-- run cleanings for added informations\n";
    for (auto const& [_, table] : Dictionary().Tables()) 
@@ -8,11 +8,15 @@
 #include <string_view>
 #include <vector>
 #include <map>
+#include <set>
 #include <utility>
 #include <string>
 #include <filesystem>
 #include <ranges>
 #include <format>
+#include <tuple>
+#include <functional>
+#include <shared_mutex>
 
 namespace fs = std::filesystem;
 using namespace std::string_literals;
@@ -26,8 +30,18 @@ class TMyDictionary;
 // ---------------------------------------------------------------------------
 
 class Generator_SQL {
+public:
+   /// \brief kind of the statements in the cache, queries are distinguished additional with the EQueryType
+   enum class EStatementKind : uint32_t { query, create_table, create_view, alter_table, primary_key, foreign_keys, unique_keys, 
+                                          check_conditions, indices, range_values, post_conditions, cleaning };
+
 private:
+   /// key for the cache of statements: name of the table, kind, query type and name of the index / reference
+   using statement_key = std::tuple<std::string, EStatementKind, EQueryType, std::string>;
+
    TMyDictionary const& dictionary;
+   mutable std::map<statement_key, myStatements, std::less<>> statements;   ///< rendered statements, shared by all generators
+   mutable std::shared_mutex                                    mtxStatements; ///< lock for the cache, generators run parallel
 public:
    Generator_SQL() = delete;
    Generator_SQL(TMyDictionary const& ref) : dictionary { ref } { }
@@ -36,6 +50,16 @@ public:
 
    TMyDictionary const& Dictionary() const { return dictionary; }
 
+   /// \brief render all statements for the table into the cache, can run parallel for different tables
+   Generator_SQL const& PrepareStatements(TMyTable const& table) const;
+
+   /// \brief remove all statements from the cache, necessary when the dictionary changed
+   void ClearStatements() const;
+
+   /// \brief move the statements of the tables of this dictionary from the cache of other, except the tables in rebuild
+   /// \details used by TMyModelWatcher, the statements of unchanged tables are taken over from the dictionary of the last run
+   void TakeStatements(Generator_SQL const& other, std::set<std::string> const& rebuild) const;
+
    Generator_SQL const& WriteCreateTable(TMyTable const& table, fs::path file) const;
    Generator_SQL const& WriteCreateTable(TMyTable const& table, std::ostream& os) const;
 
@@ -81,6 +105,22 @@ public:
 
 
 private:
+   /** \name access to the cache of statements, missing statements are built and inserted
+       \{ */
+   myStatements const& CachedStatements(TMyTable const& table, EStatementKind kind, EQueryType type, std::string_view part,
+                                        std::function<myStatements ()> const& build) const;
+
+   myStatements const& TableStatements(TMyTable const& table, EStatementKind kind) const;
+
+   template <enum EQueryType type> requires IsTableType<type>
+   myStatements const& QueryStatements(TMyTable const& table) const;
+
+   template <enum EQueryType type> requires IsIndexType<type>
+   myStatements const& QueryStatements(TMyTable const& table, TMyIndices const& index) const;
+
+   template <enum EQueryType type> requires IsReferenceType<type>
+   myStatements const& QueryStatements(TMyTable const& table, TMyReferences const& ref) const;
+   /// \}
 
    myStatements CreateTable_Statements(TMyTable const& table) const;
 
@@ -11,14 +11,7 @@ Generator_SQL const& Generator_SQL::WriteQueryHeader(TMyTable const& table, std:
 template <enum EQueryType type> requires IsTableType<type>
 Generator_SQL const& Generator_SQL::WriteQuerySource(TMyTable const& table, std::ostream& os) const {
    os << "const std::string " << std::format(GetSQLQueryName<type>(), table.Name()) << " =\n";
-   if constexpr (type == EQueryType::SelectAll)               WriteSource(CreateSelectAll_Statement(table), os);
-   else if constexpr (type == EQueryType::SelectPrim)         WriteSource(CreateSelectPrim_Statement(table), os);
-   else if constexpr (type == EQueryType::UpdateAll)          WriteSource(CreateUpdateAll_Statement(table), os);
-   else if constexpr (type == EQueryType::UpdateWithoutPrims) WriteSource(CreateUpdateWithoutPrim_Statement(table), os);
-   else if constexpr (type == EQueryType::DeleteAll)          WriteSource(CreateDeleteAll_Statement(table), os);
-   else if constexpr (type == EQueryType::DeletePrim)         WriteSource(CreateDeletePrim_Statement(table), os);
-   else if constexpr (type == EQueryType::Insert)             WriteSource(CreateInsert_Statement(table), os);
-   else static_assert(always_false<type>, "this type isn't supported with this function");
+   WriteSource(QueryStatements<type>(table), os);
    os << "\n\n";
    return *this;
    }
@@ -33,9 +26,7 @@ Generator_SQL const& Generator_SQL::WriteQueryHeader(TMyTable const& table, TMyI
 template <enum EQueryType type> requires IsIndexType<type>
 Generator_SQL const& Generator_SQL::WriteQuerySource(TMyTable const& table, TMyIndices const& index, std::ostream& os) const {
    os << "const std::string " << std::format(GetSQLQueryName<type>(), table.Name(), index.Name()) << " =\n";
-   if constexpr      (type == EQueryType::SelectUnique)  WriteSource(CreateSelectUniqueKey_Statement(table, index), os);
-   else if constexpr (type == EQueryType::SelectIdx)     WriteSource(CreateSelectIndex_Statement(table, index), os);
-   else static_assert(always_false<type>, "this type isn't supported with this function");
+   WriteSource(QueryStatements<type>(table, index), os);
    os << "\n\n";
    return *this;
    }
@@ -55,13 +46,49 @@ template <enum EQueryType type> requires IsReferenceType<type>
 Generator_SQL const& Generator_SQL::WriteQuerySource(TMyTable const& table, TMyReferences const& ref, std::ostream& os) const {
    if constexpr (type == EQueryType::SelectRelation) {
       os << "const std::string " << std::format(GetSQLQueryName<type>(), table.Name(), ref.Name()) << " =\n";
-      WriteSource(CreateSelectReference_Statement(table, ref), os);
+      WriteSource(QueryStatements<type>(table, ref), os);
       }
    else if constexpr (type == EQueryType::SelectRevRelation) {
       os << "const std::string " << std::format(GetSQLQueryName<type>(), ref.RefTable(), ref.Name()) << " =\n";
-      WriteSource(CreateSelectRevReference_Statement(table.Dictionary().FindTable(ref.RefTable()), ref), os);
+      WriteSource(QueryStatements<type>(table, ref), os);
       }
    else static_assert(always_false_querytype<type>, "this type isn't supported with this function");
    os << "\n\n";
    return *this;
    }
+
+
+// access to the cache of statements for the queries, the statements are built with the first access
+
+template <enum EQueryType type> requires IsTableType<type>
+myStatements const& Generator_SQL::QueryStatements(TMyTable const& table) const {
+   return CachedStatements(table, EStatementKind::query, type, { }, [this, &table]() {
+      if constexpr (type == EQueryType::SelectAll)               return CreateSelectAll_Statement(table);
+      else if constexpr (type == EQueryType::SelectPrim)         return CreateSelectPrim_Statement(table);
+      else if constexpr (type == EQueryType::UpdateAll)          return CreateUpdateAll_Statement(table);
+      else if constexpr (type == EQueryType::UpdateWithoutPrims) return CreateUpdateWithoutPrim_Statement(table);
+      else if constexpr (type == EQueryType::DeleteAll)          return CreateDeleteAll_Statement(table);
+      else if constexpr (type == EQueryType::DeletePrim)         return CreateDeletePrim_Statement(table);
+      else if constexpr (type == EQueryType::Insert)             return CreateInsert_Statement(table);
+      else static_assert(always_false_querytype<type>, "this type isn't supported with this function");
+      });
+   }
+
+template <enum EQueryType type> requires IsIndexType<type>
+myStatements const& Generator_SQL::QueryStatements(TMyTable const& table, TMyIndices const& index) const {
+   return CachedStatements(table, EStatementKind::query, type, index.Name(), [this, &table, &index]() {
+      if constexpr      (type == EQueryType::SelectUnique)  return CreateSelectUniqueKey_Statement(table, index);
+      else if constexpr (type == EQueryType::SelectIdx)     return CreateSelectIndex_Statement(table, index);
+      else static_assert(always_false_querytype<type>, "this type isn't supported with this function");
+      });
+   }
+
+/// \details the key uses the table with the reference, the reverse statement is built for the referenced table
+template <enum EQueryType type> requires IsReferenceType<type>
+myStatements const& Generator_SQL::QueryStatements(TMyTable const& table, TMyReferences const& ref) const {
+   return CachedStatements(table, EStatementKind::query, type, ref.Name(), [this, &table, &ref]() {
+      if constexpr (type == EQueryType::SelectRelation)         return CreateSelectReference_Statement(table, ref);
+      else if constexpr (type == EQueryType::SelectRevRelation) return CreateSelectRevReference_Statement(ref.GetRefTable(), ref);
+      else static_assert(always_false_querytype<type>, "this type isn't supported with this function");
+      });
+   }
@@ -24,9 +24,111 @@
 #include <locale>
 #include <format>
 #include <ranges>
+#include <array>
+#include <numeric>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
 namespace fs = std::filesystem;
 using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace {
+   constexpr auto source_type_alignments = std::to_array<std::pair<std::string_view, size_t>>({
+      { "bool"sv, 1 }, { "char"sv, 1 }, { "signed char"sv, 1 }, { "unsigned char"sv, 1 }, { "std::byte"sv, 1 },
+      { "int8_t"sv, 1 }, { "uint8_t"sv, 1 }, { "std::int8_t"sv, 1 }, { "std::uint8_t"sv, 1 },
+      { "short"sv, 2 }, { "short int"sv, 2 }, { "unsigned short"sv, 2 }, { "unsigned short int"sv, 2 },
+      { "int16_t"sv, 2 }, { "uint16_t"sv, 2 }, { "std::int16_t"sv, 2 }, { "std::uint16_t"sv, 2 },
+      { "std::chrono::year_month_day"sv, 2 },
+      { "int"sv, 4 }, { "unsigned"sv, 4 }, { "unsigned int"sv, 4 }, { "long"sv, 4 }, { "unsigned long"sv, 4 }, { "float"sv, 4 },
+      { "int32_t"sv, 4 }, { "uint32_t"sv, 4 }, { "std::int32_t"sv, 4 }, { "std::uint32_t"sv, 4 } });
+
+   /// \brief alignment of a source type for the sequence of the members with EMyRecordLayout::null_bitmap
+   /// \details the generator knows only the name of the type, all other types (64 bit integers, double, time points,
+   ///          classes of the standard library) are expected with the alignment of a pointer and placed at the begin
+   size_t source_type_alignment(std::string_view strType) {
+      auto it = std::ranges::find(source_type_alignments, strType, &std::pair<std::string_view, size_t>::first);
+      return it != source_type_alignments.end() ? it->second : size_t { 8 };
+      }
+
+   constexpr auto source_type_integrals = std::to_array<std::string_view>({
+      "bool"sv, "char"sv, "signed char"sv, "unsigned char"sv,
+      "short"sv, "short int"sv, "unsigned short"sv, "unsigned short int"sv,
+      "int"sv, "unsigned"sv, "unsigned int"sv, "long"sv, "long int"sv, "unsigned long"sv, "unsigned long int"sv,
+      "long long"sv, "long long int"sv, "unsigned long long"sv, "unsigned long long int"sv,
+      "int8_t"sv, "uint8_t"sv, "int16_t"sv, "uint16_t"sv, "int32_t"sv, "uint32_t"sv, "int64_t"sv, "uint64_t"sv,
+      "std::int8_t"sv, "std::uint8_t"sv, "std::int16_t"sv, "std::uint16_t"sv,
+      "std::int32_t"sv, "std::uint32_t"sv, "std::int64_t"sv, "std::uint64_t"sv });
+
+   /// \brief expression with the value of a member as std::uint64_t for the hash of the primary_key
+   /// \details integral types are used directly, dates and time points with their numeric values, all other types
+   ///          with std::hash. a type without std::hash in a primary key needs a specialization in the project
+   std::string source_type_hash(std::string_view strType, std::string const& strValue) {
+      if (std::ranges::find(source_type_integrals, strType) != source_type_integrals.end())
+         return std::format("static_cast<std::uint64_t>({})", strValue);
+      else if (strType == "std::chrono::year_month_day"sv)
+         return std::format("((static_cast<std::uint64_t>(static_cast<int>({0}.year())) << 9) ^ (static_cast<unsigned>({0}.month()) << 5) ^ static_cast<unsigned>({0}.day()))", strValue);
+      else if (strType == "std::chrono::system_clock::time_point"sv)
+         return std::format("static_cast<std::uint64_t>({}.time_since_epoch().count())", strValue);
+      else
+         return std::format("static_cast<std::uint64_t>(std::hash<{}>{{ }}({}))", strType, strValue);
+      }
+
+   /// \brief integral source types with a fixed width on all platforms (count of bits, signed), long and char are missing
+   constexpr auto source_type_packings = std::to_array<std::tuple<std::string_view, size_t, bool>>({
+      { "bool"sv, 1, false }, { "signed char"sv, 8, true }, { "unsigned char"sv, 8, false },
+      { "short"sv, 16, true }, { "short int"sv, 16, true }, { "unsigned short"sv, 16, false }, { "unsigned short int"sv, 16, false },
+      { "int"sv, 32, true }, { "unsigned"sv, 32, false }, { "unsigned int"sv, 32, false },
+      { "long long"sv, 64, true }, { "long long int"sv, 64, true }, { "unsigned long long"sv, 64, false }, { "unsigned long long int"sv, 64, false },
+      { "int8_t"sv, 8, true }, { "uint8_t"sv, 8, false }, { "int16_t"sv, 16, true }, { "uint16_t"sv, 16, false },
+      { "int32_t"sv, 32, true }, { "uint32_t"sv, 32, false }, { "int64_t"sv, 64, true }, { "uint64_t"sv, 64, false },
+      { "std::int8_t"sv, 8, true }, { "std::uint8_t"sv, 8, false }, { "std::int16_t"sv, 16, true }, { "std::uint16_t"sv, 16, false },
+      { "std::int32_t"sv, 32, true }, { "std::uint32_t"sv, 32, false }, { "std::int64_t"sv, 64, true }, { "std::uint64_t"sv, 64, false } });
+
+   /// \brief attribute of a primary key in the packed representation
+   struct my_packed_part {
+      std::string strMember;       ///< member of the primary_key class
+      size_t      iBits;           ///< count of bits of the type
+      bool        boSigned;        ///< signed type, the sign bit is inverted so the unsigned values keep the sequence
+      size_t      iWord;           ///< word of the packed key, 0 = first (high) word
+      size_t      iShift = 0;      ///< position of the value in the word
+      };
+
+   /// \brief layout of the packed primary key, the attributes in the sequence of the key from the high to the low bits
+   /// \details the primary key is packed when all attributes are integral and they fit into one or two words of
+   ///          64 bits, an attribute isn't split between the words. otherwise the layout is empty and the generated
+   ///          class compares the attributes one after another
+   std::vector<my_packed_part> packed_key_layout(std::vector<std::pair<TMyAttribute, TMyDatatype>> const& prim_attr) {
+      std::vector<my_packed_part> layout;
+      std::array<size_t, 2> used = { 0, 0 };
+      size_t iWord = 0;
+      for (auto const& [attr, dtype] : prim_attr) {
+         auto it = std::ranges::find(source_type_packings, dtype.SourceType(), [](auto const& p) { return std::get<0>(p); });
+         if (it == source_type_packings.end()) return { };
+         auto const& [_, iBits, boSigned] = *it;
+         if (used[iWord] + iBits > 64 && ++iWord == used.size()) return { };
+         layout.push_back({ .strMember = dtype.Prefix() + attr.Name(), .iBits = iBits, .boSigned = boSigned, .iWord = iWord, .iShift = used[iWord] });
+         used[iWord] += iBits;
+         }
+      for (auto& part : layout) part.iShift = used[part.iWord] - part.iShift - part.iBits;
+      return layout;
+      }
+
+   /// \brief expression for the value of one word of the packed primary key
+   std::string packed_key_word(std::vector<my_packed_part> const& layout, size_t iWord) {
+      std::string strWord;
+      for (auto const& part : layout | std::views::filter([iWord](auto const& p) { return p.iWord == iWord; })) {
+         std::string strValue;
+         if (!part.boSigned) strValue = std::format("static_cast<std::uint64_t>({})", part.strMember);
+         else if (part.iBits == 64) strValue = std::format("(static_cast<std::uint64_t>({}) ^ {:#x}ull)", part.strMember, uint64_t { 1 } << 63);
+         else strValue = std::format("static_cast<std::uint64_t>(static_cast<std::uint{}_t>({}) ^ {:#x}u)", part.iBits, part.strMember, uint64_t { 1 } << (part.iBits - 1));
+         if (part.iShift > 0) strValue = std::format("({} << {})", strValue, part.iShift);
+         strWord += (strWord.empty() ? ""s : " | "s) + strValue;
+         }
+      return strWord;
+      }
+   }
 
 
 // -----------------------------------------------------------------------------------------
@@ -66,11 +168,17 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
       // write header files for base classes
       if (!parents.empty()) {
          os << "\n// includes for required header files of base classes\n";
-         std::ranges::for_each(parents, [&os](auto const& p) { os << std::format("#include {}\n", p.Include()); });
+         std::ranges::for_each(parents, [&os](TMyTable const& p) { os << std::format("#include {}\n", p.Include()); });
          }
       else if(Dictionary().UseBaseClass()) {
          os << "\n// includes for common  virtual base class\n";
-         os << std::format("#include \"{}\"\n", (Dictionary().PathToBase() / "BaseClass.h"s).string());
+         out_format(os, "#include \"{}\"\n", (Dictionary().PathToBase() / "BaseClass.h"s).string());
+         }
+
+      // own::flat_map for the container type of the class, own::hash_map for hash_container_ty
+      if (ContainerType() == EMyContainerType::flat_map || Dictionary().HashContainer()) {
+         os << "\n// includes for the common definitions of the project\n";
+         out_format(os, "#include \"{}\"\n", (Dictionary().PathToBase() / "BaseDefinitions.h"s).string());
          }
 
       // write header files for compositions
@@ -82,7 +190,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
 
       // find necessary header files for used datatypes
       auto types = Attributes() | std::views::transform([this](auto const& s) {
-                                   auto const& dt = Dictionary().FindDataType(s.DataType());
+                                   auto const& dt = s.GetDataType();
                                    return dt.Headerfile(); })
                                 | std::ranges::to<std::set<std::string>>();
 
@@ -102,10 +210,21 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
          << "#include <vector>\n"
          << "#include <tuple>\n"  // possible to avoid this (count of primary keys && count of composed keys < 2
          << "#include <memory>\n" // possible to avoid this when gerneral used std::tuple  !!!
-         << "\n";
+         << "#include <cstddef>\n"
+         << "#include <cstdint>\n";
+      bool const boNullBitmap = Dictionary().RecordLayout() == EMyRecordLayout::null_bitmap;
+      if (boNullBitmap || Dictionary().ColumnContainer()) os << "#include <array>\n";
+      if (Dictionary().ColumnContainer()) os << "#include <string>\n"
+                                             << "#include <ranges>\n";
+      os << "\n";
 
       auto processing_data = GetProcessing_Data();
 
+      // position of the attribute in the null bitmap, the sequence of the attributes in the table
+      auto null_bit = [&processing_data](TMyAttribute const& attr) -> size_t {
+         return static_cast<size_t>(std::ranges::find(processing_data, attr.Name(), [](auto const& p) -> std::string const& { return p.first.Name(); }) - processing_data.begin());
+         };
+
       // ---------- determine the maximal width for attributes ---------------------------------
       auto maxElement = std::ranges::max_element(processing_data, [](auto const& a, auto const& b) {
          return a.second.SourceType().size() < b.second.SourceType().size(); });
@@ -181,7 +300,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
       // write base classes from references
       if (!parents.empty()) {
          size_t i = 0;
-         std::ranges::for_each(parents, [this, &os, &i](auto const& p) { 
+         std::ranges::for_each(parents, [this, &os, &i](TMyTable const& p) { 
                                        os << (i++ > 0 ? ", public " : ": public ") 
                                           << (Namespace() != p.Namespace() ? p.FullClassName() : p.ClassName()); 
                                        });
@@ -214,6 +333,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
       // after finishing this class, we will use this for the primary attributes in the encircling class too
       // ---------------------------------------------------------------------------------------------------------
       auto prim_attr = processing_data | std::views::filter([](auto const& a) { return std::get<0>(a).Primary(); }) | std::ranges::to<std::vector>();
+      auto const packed_key = packed_key_layout(prim_attr);
       if(prim_attr.size() == 0) [[unlikely]] 
          throw std::runtime_error(std::format("critical error: missing primary key for table \"{}\".", Name()));
       else {
@@ -254,12 +374,12 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
          // member for the primary key attributes
          for (auto const& [attr, dtype] : prim_attr) {
             std::string strAttribute = dtype.Prefix() + attr.Name() + ";"s;
-            os << std::format("{0}{1:<{2}}{3:<{4}}\n", my_indent(4), dtype.SourceType(), maxLengthPrimType, strAttribute, maxLengthAttr);
+            out_format(os, "{0}{1:<{2}}{3:<{4}}\n", my_indent(4), dtype.SourceType(), maxLengthPrimType, strAttribute, maxLengthAttr);
             }
          os << "\n";
 
          // standard constructor for the primary_key type
-         os << std::format("{0}primary_key();\n", my_indent(4));
+         out_format(os, "{0}primary_key();\n", my_indent(4));
 
          os << my_indent(3) << "public:\n";
 
@@ -271,56 +391,68 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
                                                          (std::get<1>(prim_attr[0]).UseReference() ? " const&" : ""),
                                                          std::get<0>(prim_attr[0]).Name());
          for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) 
-            os << std::format(", {0}{1} p{2}", dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Name());
+            out_format(os, ", {0}{1} p{2}", dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Name());
          os << ");\n";
 
          // constructor for the primary_key type with the incircling class
          // can't be constexpr because Manipulator can throw an exception
-         os << std::format("{0}explicit primary_key({1} const& other);\n", my_indent(4), ClassName());
+         out_format(os, "{0}explicit primary_key({1} const& other);\n", my_indent(4), ClassName());
 
          // copy constructor for the primary_key type
-         os << std::format("{0}primary_key(primary_key const& other);\n", my_indent(4));
+         out_format(os, "{0}primary_key(primary_key const& other);\n", my_indent(4));
 
          // move constructor for the primary_key type
-         os << std::format("{0}primary_key(primary_key&& other) noexcept;\n", my_indent(4));
+         out_format(os, "{0}primary_key(primary_key&& other) noexcept;\n", my_indent(4));
+
+         // copy and move assignment for the primary_key type, necessary for containers like own::flat_map
+         out_format(os, "{0}primary_key& operator = (primary_key const& other);\n", my_indent(4));
+         out_format(os, "{0}primary_key& operator = (primary_key&& other) noexcept;\n", my_indent(4));
 
          // constructors for inherited classes
          // can't be constexpr because Manipulator can throw an exception
          // auto inherited = GetPart_ofs(EMyReferenceType::generalization);
          if(!inherited.empty()) {
             for(auto const& [table, type_name, var_name, key_val, key_pairs] : inherited) {
-               os << std::format("{0}primary_key({1} const& other);\n", my_indent(4), table.FullClassName());
+               out_format(os, "{0}primary_key({1} const& other);\n", my_indent(4), table.FullClassName());
                }
             }
 
-         os << std::format("{}~primary_key() {{ }}\n", my_indent(4));
+         out_format(os, "{}~primary_key() {{ }}\n", my_indent(4));
 
          os << '\n'
             << my_indent(4) << "// conversions operator for this element to the encircling class\n"
             << std::format("{0}operator {1}() const;\n", my_indent(4), ClassName());
 
          os << '\n'
-            << my_indent(4) << "// relational operators of the primary type class\n"
-            << my_indent(4) << "bool operator == (primary_key const& other) const { return _compare(other) == 0; }\n"
-            << my_indent(4) << "bool operator != (primary_key const& other) const { return _compare(other) != 0; }\n"
-            << my_indent(4) << "bool operator <  (primary_key const& other) const { return _compare(other) <  0; }\n"
-            << my_indent(4) << "bool operator <= (primary_key const& other) const { return _compare(other) <= 0; }\n"
-            << my_indent(4) << "bool operator >  (primary_key const& other) const { return _compare(other) >  0; }\n"
-            << my_indent(4) << "bool operator >= (primary_key const& other) const { return _compare(other) >= 0; }\n";
+            << my_indent(4) << "// relational operators of the primary type class\n";
+         if (packed_key.empty()) {
+            os << my_indent(4) << "bool operator == (primary_key const& other) const { return _compare(other) == 0; }\n"
+               << my_indent(4) << "bool operator != (primary_key const& other) const { return _compare(other) != 0; }\n"
+               << my_indent(4) << "bool operator <  (primary_key const& other) const { return _compare(other) <  0; }\n"
+               << my_indent(4) << "bool operator <= (primary_key const& other) const { return _compare(other) <= 0; }\n"
+               << my_indent(4) << "bool operator >  (primary_key const& other) const { return _compare(other) >  0; }\n"
+               << my_indent(4) << "bool operator >= (primary_key const& other) const { return _compare(other) >= 0; }\n";
+            }
+         else {
+            // all attributes are integral, the packed words are compared instead of the attributes
+            for (auto const& strOperator : { "=="sv, "!="sv, "<"sv, "<="sv, ">"sv, ">="sv }) {
+               out_format(os, "{0}bool operator {1:<2} (primary_key const& other) const {{ return _packed() {1} other._packed(); }}\n", my_indent(4), strOperator);
+               }
+            }
 
          os << '\n'
             << my_indent(4) << "// selectors the primary type class\n";
          for (auto const& [attr, dtype] : prim_attr) {
             std::string strRetType = dtype.SourceType() + (dtype.UseReference() ? "const& "s : " ");
             std::string strAttribute = dtype.Prefix() + attr.Name();
-            os << std::format("{0}{1:<{2}}{3}() const {{ return {4}; }}\n", my_indent(4), strRetType, maxLengthPrimType + 7, attr.Name(), strAttribute);
+            out_format(os, "{0}{1:<{2}}{3}() const {{ return {4}; }}\n", my_indent(4), strRetType, maxLengthPrimType + 7, attr.Name(), strAttribute);
             }
          os << '\n'
             << my_indent(4) << "// manipulators the primary type class\n";
          for (auto const& [attr, dtype] : prim_attr) {
             std::string strRetType = dtype.SourceType() + (dtype.UseReference() ? "const& "s : " ");
             std::string strAttribute = dtype.Prefix() + attr.Name();
-            os << std::format("{0}{1:<{2}}{3}({1}newVal) {{ return {4} = newVal; }}\n", my_indent(4), strRetType, maxLengthPrimType + 7, attr.Name(), strAttribute);
+            out_format(os, "{0}{1:<{2}}{3}({1}newVal) {{ return {4} = newVal; }}\n", my_indent(4), strRetType, maxLengthPrimType + 7, attr.Name(), strAttribute);
             }
          os << "\n";
 
@@ -328,10 +460,19 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
             << my_indent(4) << "std::ostream& write(std::ostream& out) const;\n"
             << "\n";
 
+         os << my_indent(4) << "// hash value of the primary key for unordered containers, used by std::hash<primary_key>\n"
+            << my_indent(4) << "std::size_t hash() const;\n"
+            << "\n";
+
          os << my_indent(3) << "private:\n";
 
-         os << my_indent(4) << "int _compare(primary_key const& other) const;\n"
-            << my_indent(3) << "};\n\n";
+         os << my_indent(4) << "int _compare(primary_key const& other) const;\n";
+         if (!packed_key.empty()) {
+            out_format(os, "{0}// attributes of the key packed into {1} in the sequence of the key, signed values with inverted sign bit\n"
+                           "{0}{2} _packed() const;\n", my_indent(4), packed_key.back().iWord == 0 ? "one integer" : "two integers",
+                           packed_key.back().iWord == 0 ? "std::uint64_t" : "std::pair<std::uint64_t, std::uint64_t>");
+            }
+         os << my_indent(3) << "};\n\n";
          }
       /*
       std::string strKeyGenerate;
@@ -361,8 +502,12 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
       // --------------- create function, map and vector types for this class ---------------------------
       // ------------------------------------------------------------------------------------------------
       os << my_indent(2) << "using func_ty = std::function<bool(" << ClassName() << "&&)>;\n"
-         << my_indent(2) << "using container_ty = std::map<primary_key, " << ClassName() << ">;\n"
-         << my_indent(2) << "using vector_ty    = std::vector<" << ClassName() << ">;\n\n";
+         << my_indent(2) << "using container_ty = " << (ContainerType() == EMyContainerType::flat_map ? "own::flat_map<"s : "std::map<"s)
+                                                      << "primary_key, " << ClassName() << ">;\n"
+         << my_indent(2) << "using vector_ty    = std::vector<" << ClassName() << ">;\n";
+      if (Dictionary().HashContainer()) os << my_indent(2) << "using hash_container_ty = own::hash_map<primary_key, " << ClassName() << ">;\n";
+      if (Dictionary().ColumnContainer()) os << my_indent(2) << "class columns_ty;   // column container (structure of arrays), defined after the class\n";
+      os << "\n";
 
       // ---------------- generate datatypes for composed tables ---------------------------------------
       // Attention: Part of relationships as aggregation to relations are difficult and should treat other
@@ -380,7 +525,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
                   break;
                case 1: 
                   {
-                  os << "std::map<" << Dictionary().FindDataType(table.FindAttribute(vecKeys[0]).DataType()).SourceType() << ", "
+                  os << "std::map<" << table.FindAttribute(vecKeys[0]).GetDataType().SourceType() << ", "
                      << (Namespace() != table.Namespace() ? table.FullClassName() : table.ClassName())
                      << ">";
                   }
@@ -403,10 +548,27 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
          << my_indent(2) << "// private data elements, direct attributes from table " << SQLName() << "\n"
          << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n";
 
-      for (auto const& [attr, dtype] : processing_data) {
-         std::string strType = "std::optional<"s + dtype.SourceType() + ">"s;
-         std::string strAttribute = dtype.Prefix() + attr.Name() + ";"s;
-         os << std::format("{0}{1:<{2}}{3:<{4}}\n", my_indent(2), strType, maxLengthType + 15, strAttribute, maxLengthAttr);
+      if (!boNullBitmap) {
+         for (auto const& [attr, dtype] : processing_data) {
+            std::string strType = "std::optional<"s + dtype.SourceType() + ">"s;
+            std::string strAttribute = dtype.Prefix() + attr.Name() + ";"s;
+            out_format(os, "{0}{1:<{2}}{3:<{4}}\n", my_indent(2), strType, maxLengthType + 15, strAttribute, maxLengthAttr);
+            }
+         }
+      else {
+         // plain members sorted by their alignment without padding between them, the bitmap at the end fills the rest
+         std::vector<size_t> layout(processing_data.size());
+         std::iota(layout.begin(), layout.end(), size_t { 0 });
+         std::ranges::stable_sort(layout, std::ranges::greater { }, [&processing_data](size_t i) {
+                                     return source_type_alignment(processing_data[i].second.SourceType()); });
+         for (auto i : layout) {
+            auto const& [attr, dtype] = processing_data[i];
+            std::string strAttribute = dtype.Prefix() + attr.Name() + " { };"s;
+            out_format(os, "{0}{1:<{2}}{3:<{4}}\n", my_indent(2), dtype.SourceType(), maxLengthType + 15, strAttribute, maxLengthAttr);
+            }
+         os << my_indent(2) << "// null bitmap, a set bit for every attribute with a value in the sequence of the table\n";
+         out_format(os, "{0}{1:<{2}}{3:<{4}}\n", my_indent(2), std::format("std::array<std::uint8_t, {}>", (processing_data.size() + 7) / 8),
+                                                  maxLengthType + 15, "_present { };"s, maxLengthAttr);
          }
 
       // --------------- generate data elements for the table which are part of related --------------
@@ -416,7 +578,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
             << my_indent(2) << "// data elements for composed tables\n"
             << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n";
          for(auto const& [table, strType, strVar, vecKeys, vecParams] : part_of_data) {
-            os << std::format("{0}{1:<{2}}{3};\n", my_indent(2), strType, maxLengthType + 15, strVar);
+            out_format(os, "{0}{1:<{2}}{3};\n", my_indent(2), strType, maxLengthType + 15, strVar);
             }
          }
 
@@ -443,7 +605,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
       os << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n"
          << my_indent(2) << "// public functions for this class (following the framework for this project)\n"
          << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n";
-      os << std::format("{}void swap({}& rhs) noexcept;\n", my_indent(2), ClassName());
+      out_format(os, "{}void swap({}& rhs) noexcept;\n", my_indent(2), ClassName());
       if (Dictionary().UseBaseClass()) {
          auto param_ty = Dictionary().BaseNamespace() != Namespace() ? Dictionary().BaseNamespace() + "::"s + Dictionary().BaseClass() : Dictionary().BaseClass();
          os << std::format("{0}virtual void init() override;\n", my_indent(2))
@@ -469,10 +631,17 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
          << my_indent(2) << "// selectors for the data access to the direct data elements with std::optional retval\n"
          << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n";
       for (auto const& [attr, dtype] : processing_data) {
-         std::string strRetType = "std::optional<"s + dtype.SourceType() + "> const&"s;
          std::string strSelector = attr.Name();
          std::string strAttribute = dtype.Prefix() + attr.Name();
-         os << std::format("{0}{1:<{2}}{3}() const {{ return {4}; }}\n", my_indent(2), strRetType, maxLengthType + 22, strSelector, strAttribute);
+         if (!boNullBitmap) {
+            std::string strRetType = "std::optional<"s + dtype.SourceType() + "> const&"s;
+            out_format(os, "{0}{1:<{2}}{3}() const {{ return {4}; }}\n", my_indent(2), strRetType, maxLengthType + 22, strSelector, strAttribute);
+            }
+         else {
+            std::string strRetType = "std::optional<"s + dtype.SourceType() + ">"s;
+            out_format(os, "{0}{1:<{2}}{3}() const {{ return _has_value({5}) ? {1}({4}) : std::nullopt; }}\n", my_indent(2), strRetType,
+                                                   maxLengthType + 22, strSelector, strAttribute, null_bit(attr));
+            }
          }
       os << "\n";
 
@@ -484,7 +653,7 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
          std::string strRetType = dtype.SourceType() + (dtype.UseReference() ? " const&"s : ""s);
          std::string strSelector = attr.Name();
          std::string strComment = attr.Comment_Attribute();
-         os << std::format("{0}{1:<{2}}_{3}() const;\n", my_indent(2), strRetType, maxLengthType + 22, strSelector);
+         out_format(os, "{0}{1:<{2}}_{3}() const;\n", my_indent(2), strRetType, maxLengthType + 22, strSelector);
          }
       os << "\n";
 
@@ -508,10 +677,11 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
             << my_indent(2) << "// public manipulators for the class\n"
             << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n";
          for (auto const& [attr, dtype] : processing_data | std::views::filter([](auto const& val) { return !val.first.IsComputed(); })) {
-            std::string strRetType = "std::optional<"s + dtype.SourceType() + "> const&"s;
+            std::string strParamType = "std::optional<"s + dtype.SourceType() + "> const&"s;
+            std::string strRetType = boNullBitmap ? "std::optional<"s + dtype.SourceType() + ">"s : strParamType;
             std::string strManipulator = attr.Name();
             std::string strAttribute = dtype.Prefix() + attr.Name();
-            os << std::format("{0}{1:<{2}}{3}({1} newVal);\n", my_indent(2), strRetType, maxLengthType + 22, strManipulator);
+            out_format(os, "{0}{1:<{2}}{3}({4} newVal);\n", my_indent(2), strRetType, maxLengthType + 22, strManipulator, strParamType);
             }
          os << "\n";
 
@@ -535,10 +705,11 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
             << my_indent(2) << "// private  manipulators for the class\n"
             << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n";
          for (auto const& [attr, dtype] : comp_attr) {
-            std::string strRetType = "std::optional<"s + dtype.SourceType() + "> const&"s;
+            std::string strParamType = "std::optional<"s + dtype.SourceType() + "> const&"s;
+            std::string strRetType = boNullBitmap ? "std::optional<"s + dtype.SourceType() + ">"s : strParamType;
             std::string strManipulator = attr.Name();
             std::string strAttribute = dtype.Prefix() + attr.Name();
-            os << std::format("{0}{1:<{2}}{3}({1} newVal);\n", my_indent(2), strRetType, maxLengthType + 22, strManipulator);
+            out_format(os, "{0}{1:<{2}}{3}({4} newVal);\n", my_indent(2), strRetType, maxLengthType + 22, strManipulator, strParamType);
             }
          os << "\n";
          }
@@ -558,11 +729,33 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
          << my_indent(2) << "// ----------------------------------------------------------------------------------------------\n"
          << std::format("{}void _swap({}& rhs) noexcept;\n", my_indent(2), ClassName())
          << my_indent(2) << "void _init();\n"
-         << my_indent(2) << "void _copy(" << ClassName() << " const& other);\n"
-         << "\n";
+         << my_indent(2) << "void _copy(" << ClassName() << " const& other);\n";
+      if (boNullBitmap) {
+         os << my_indent(2) << "bool _has_value(std::size_t iBit) const noexcept { return (_present[iBit / 8] & (1u << (iBit % 8))) != 0; }\n"
+            << my_indent(2) << "void _has_value(std::size_t iBit, bool boValue) noexcept {\n"
+            << my_indent(3) << "if (boValue) _present[iBit / 8] |= static_cast<std::uint8_t>(1u << (iBit % 8));\n"
+            << my_indent(3) << "else         _present[iBit / 8] &= static_cast<std::uint8_t>(~(1u << (iBit % 8)));\n"
+            << my_indent(3) << "}\n";
+         }
+      os << "\n";
 
       os << "   };\n\n";
 
+      if (Dictionary().ColumnContainer()) CreateColumns(os);
+
+      if (!packed_key.empty()) {
+         os << "// -------------------------------------------------------------------------------------------------\n"
+            << "// Implementation of the packed primary key, used for the comparisons and the hash of the key\n"
+            << "// -------------------------------------------------------------------------------------------------\n";
+         if (packed_key.back().iWord == 0) {
+            out_format(os, "inline std::uint64_t {0}::primary_key::_packed() const {{\n   return {1};\n   }}\n\n", ClassName(), packed_key_word(packed_key, 0));
+            }
+         else {
+            out_format(os, "inline std::pair<std::uint64_t, std::uint64_t> {0}::primary_key::_packed() const {{\n"
+                           "   return {{ {1},\n            {2} }};\n   }}\n\n", ClassName(), packed_key_word(packed_key, 0), packed_key_word(packed_key, 1));
+            }
+         }
+
       os << "// -------------------------------------------------------------------------------------------------\n"
          << "// Implementations of the special selectors for return values instead std::optional\n"
          << "// -------------------------------------------------------------------------------------------------\n";
@@ -570,10 +763,13 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
                std::string strRetType = dtype.SourceType() + (dtype.UseReference() ? " const&"s : ""s);
                std::string strSelector = attr.Name();
                std::string strAttribute = dtype.Prefix() + attr.Name();
-               std::string strReturn = std::format("   if({0}) [[likely]] return {0}.value();\n"
+               std::string strReturn = !boNullBitmap ? std::format("   if({0}) [[likely]] return {0}.value();\n"
+                  "   else throw std::runtime_error(\"value for attribute \\\"{1}\\\" in class \\\"{2}\\\" is empty.\");",
+                  strAttribute, attr.Name(), ClassName()) :
+                                                       std::format("   if(_has_value({3})) [[likely]] return {0};\n"
                   "   else throw std::runtime_error(\"value for attribute \\\"{1}\\\" in class \\\"{2}\\\" is empty.\");",
-                  strAttribute, attr.Name(), ClassName());
-               os << std::format("inline {1} {0}::_{2}() const {{\n{3};\n   }}\n\n", ClassName(), strRetType, strSelector, strReturn);
+                  strAttribute, attr.Name(), ClassName(), null_bit(attr));
+               out_format(os, "inline {1} {0}::_{2}() const {{\n{3};\n   }}\n\n", ClassName(), strRetType, strSelector, strReturn);
                }
 
 
@@ -582,14 +778,31 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
             if (EntityType() != EMyEntityType::view) {   // must checked because there should be private manipulators
                os << "// Implementations of the manipulators\n";
                for (auto const& [attr, dtype] : processing_data ) { // | std::views::filter([](auto const& val) { return !val.first.IsComputed(); })) {
-                  std::string strRetType = "std::optional<"s + dtype.SourceType() + "> const&"s;
                   std::string strManipulator = ClassName() + "::"s + attr.Name();
                   std::string strAttribute = dtype.Prefix() + attr.Name();
-                  os << std::format("inline {0} {1}({0} newVal) {{\n   return {2} = newVal;\n   }}\n\n", strRetType, strManipulator, strAttribute);
+                  if (!boNullBitmap) {
+                     std::string strRetType = "std::optional<"s + dtype.SourceType() + "> const&"s;
+                     out_format(os, "inline {0} {1}({0} newVal) {{\n   return {2} = newVal;\n   }}\n\n", strRetType, strManipulator, strAttribute);
+                     }
+                  else {
+                     // a NULL resets the member too, so the memory of strings is released and the copies are equal
+                     std::string strRetType = "std::optional<"s + dtype.SourceType() + ">"s;
+                     out_format(os, "inline {0} {1}({0} const& newVal) {{\n"
+                                    "   if(newVal) {{ {2} = *newVal; _has_value({3}, true); }}\n"
+                                    "   else {{ {2} = {{ }}; _has_value({3}, false); }}\n"
+                                    "   return newVal;\n   }}\n\n", strRetType, strManipulator, strAttribute, null_bit(attr));
+                     }
                   }
                }
 
             if (boHasNamespace) os << "} // end of namespace " << Namespace() << "\n";
+
+            // std::hash for the primary key, so the key can be used in std::unordered_map and own::hash_map
+            os << "\n// hash of the primary key for unordered containers\n"
+               << "template <>\n"
+               << std::format("struct std::hash<{}::primary_key> {{\n", FullClassName())
+               << std::format("{0}std::size_t operator () ({1}::primary_key const& key) const {{ return key.hash(); }}\n", my_indent(1), FullClassName())
+               << my_indent(1) << "};\n";
       }
    catch (std::exception& ex) {
       std::cerr << ex.what() << '\n';
@@ -598,6 +811,168 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
    return true;
    }
 
+// -----------------------------------------------------------------------------------------
+/*
+ * \brief the primary_key of the table uses the packed representation, same condition as in CreateHeader
+ */
+bool TMyTable::PackedKey() const {
+   auto prim_attr = GetProcessing_Data() | std::views::filter([](auto const& a) { return std::get<0>(a).Primary(); }) | std::ranges::to<std::vector>();
+   return !packed_key_layout(prim_attr).empty();
+   }
+
+// -----------------------------------------------------------------------------------------
+/*
+ * \brief method to create the column container columns_ty for the header file
+ * \details the container holds one vector for every attribute of the table and one validity bitmap
+ *          for every attribute, a scan over one attribute reads only the values of this attribute.
+ *          the data elements of composed tables and of base classes aren't part of the container.
+ */
+void TMyTable::CreateColumns(std::ostream& os) const {
+   auto processing_data = GetProcessing_Data();
+
+   auto maxElement = std::ranges::max_element(processing_data, [](auto const& a, auto const& b) {
+      return a.second.SourceType().size() < b.second.SourceType().size(); });
+   size_t maxLengthType = maxElement != processing_data.end() ? maxElement->second.SourceType().size() : 0;
+
+   os << "// -------------------------------------------------------------------------------------------------\n"
+      << "// column container for the class " << ClassName() << " (structure of arrays)\n"
+      << "// - one vector for every attribute of the table and one validity bitmap for every attribute\n"
+      << "// - rows are appended with push_back, read with a row_view or as data class with get\n"
+      << "// -------------------------------------------------------------------------------------------------\n"
+      << "class " << ClassName() << "::columns_ty {\n"
+      << "   public:\n"
+      << my_indent(2) << "using value_type = " << ClassName() << ";\n\n";
+
+   // ------------------------ view to one row with the selectors of the data class -------------------------
+   os << my_indent(2) << "// view to one row of the container with the selectors of the data class\n"
+      << my_indent(2) << "class row_view {\n"
+      << my_indent(3) << "friend class columns_ty;\n"
+      << my_indent(3) << "private:\n"
+      << my_indent(4) << "columns_ty const* columns;\n"
+      << my_indent(4) << "std::size_t       iRow;\n\n"
+      << my_indent(4) << "row_view(columns_ty const& cols, std::size_t row) : columns(&cols), iRow(row) { }\n"
+      << my_indent(3) << "public:\n"
+      << std::format("{0}{1:<{2}}Row() const {{ return iRow; }}\n", my_indent(4), "std::size_t"s, maxLengthType + 16)
+      << std::format("{0}{1:<{2}}get() const {{ return columns->get(iRow); }}\n", my_indent(4), ClassName(), maxLengthType + 16);
+   for (auto const& [attr, dtype] : processing_data) {
+      std::string strRetType = dtype.SourceType() + (dtype.UseReference() ? " const&"s : ""s);
+      out_format(os, "{0}{1:<{2}}{3}() const {{ return columns->{3}(iRow); }}\n", my_indent(4),
+                                  "std::optional<"s + dtype.SourceType() + ">"s, maxLengthType + 16, attr.Name());
+      out_format(os, "{0}{1:<{2}}_{3}() const {{ return columns->_{3}(iRow); }}\n", my_indent(4), strRetType, maxLengthType + 16, attr.Name());
+      }
+   os << my_indent(3) << "};\n\n";
+
+   // ------------------------ columns and validity bitmaps -------------------------------------------------
+   std::string strBitmaps = std::format("std::array<std::vector<std::uint64_t>, {}>", processing_data.size());
+   size_t maxLengthMember = std::max(maxLengthType + 16, strBitmaps.size() + 1);
+   os << "   private:\n";
+   out_format(os, "{0}{1:<{2}}iRows = 0;\n", my_indent(2), "std::size_t"s, maxLengthMember);
+   out_format(os, "{0}{1:<{2}}_present;   // validity bitmaps, a set bit for every row with a value\n", my_indent(2), strBitmaps, maxLengthMember);
+   for (auto const& [attr, dtype] : processing_data) {
+      out_format(os, "{0}{1:<{2}}{3};\n", my_indent(2), "std::vector<"s + dtype.SourceType() + ">"s, maxLengthMember, dtype.Prefix() + attr.Name());
+      }
+   os << "\n";
+
+   // ------------------------ constructors, size and append -----------------------------------------------
+   os << "   public:\n"
+      << my_indent(2) << "columns_ty() = default;\n"
+      << my_indent(2) << "explicit columns_ty(vector_ty const& data) {\n"
+      << my_indent(3) << "reserve(data.size());\n"
+      << my_indent(3) << "for (auto const& row : data) push_back(row);\n"
+      << my_indent(3) << "}\n\n"
+      << my_indent(2) << "std::size_t size() const { return iRows; }\n"
+      << my_indent(2) << "bool        empty() const { return iRows == 0; }\n\n";
+
+   os << my_indent(2) << "void reserve(std::size_t iCount) {\n"
+      << my_indent(3) << "for (auto& bits : _present) bits.reserve((iCount + 63) / 64);\n";
+   for (auto const& [attr, dtype] : processing_data) out_format(os, "{0}{1}.reserve(iCount);\n", my_indent(3), dtype.Prefix() + attr.Name());
+   os << my_indent(3) << "}\n\n";
+
+   os << my_indent(2) << "void clear() {\n"
+      << my_indent(3) << "iRows = 0;\n"
+      << my_indent(3) << "for (auto& bits : _present) bits.clear();\n";
+   for (auto const& [attr, dtype] : processing_data) out_format(os, "{0}{1}.clear();\n", my_indent(3), dtype.Prefix() + attr.Name());
+   os << my_indent(3) << "}\n\n";
+
+   os << my_indent(2) << "// append the values of the data class as new row\n"
+      << my_indent(2) << "void push_back(" << ClassName() << " const& data) {\n"
+      << my_indent(3) << "if (iRows % 64 == 0) for (auto& bits : _present) bits.push_back(0);\n";
+   for (size_t iAttr = 0; auto const& [attr, dtype] : processing_data) {
+      out_format(os, "{0}_append({1}, data.{2}(), {3});\n", my_indent(3), iAttr++, attr.Name(), dtype.Prefix() + attr.Name());
+      }
+   os << my_indent(3) << "++iRows;\n"
+      << my_indent(3) << "}\n\n";
+
+   // ------------------------ access to the rows ----------------------------------------------------------
+   os << my_indent(2) << "row_view operator [] (std::size_t iRow) const { return row_view(*this, iRow); }\n"
+      << my_indent(2) << "row_view at(std::size_t iRow) const {\n"
+      << my_indent(3) << "if (iRow >= iRows) [[unlikely]] throw std::out_of_range(\"row \" + std::to_string(iRow) + \" out of range in the column container of class \\\""
+                      << ClassName() << "\\\".\");\n"
+      << my_indent(3) << "return row_view(*this, iRow);\n"
+      << my_indent(3) << "}\n"
+      << my_indent(2) << "auto rows() const {\n"
+      << my_indent(3) << "return std::views::iota(std::size_t { 0 }, iRows) | std::views::transform([this](std::size_t iRow) { return row_view(*this, iRow); });\n"
+      << my_indent(3) << "}\n\n";
+
+   os << my_indent(2) << "// conversions to the data class and to the vector of the data class\n"
+      << my_indent(2) << ClassName() << " get(std::size_t iRow) const {\n"
+      << my_indent(3) << ClassName() << " data;\n";
+   for (auto const& [attr, dtype] : processing_data) out_format(os, "{0}data.{1}({1}(iRow));\n", my_indent(3), attr.Name());
+   os << my_indent(3) << "return data;\n"
+      << my_indent(3) << "}\n\n"
+      << my_indent(2) << "vector_ty to_vector() const {\n"
+      << my_indent(3) << "vector_ty data;\n"
+      << my_indent(3) << "data.reserve(iRows);\n"
+      << my_indent(3) << "for (std::size_t iRow = 0; iRow < iRows; ++iRow) data.emplace_back(get(iRow));\n"
+      << my_indent(3) << "return data;\n"
+      << my_indent(3) << "}\n\n";
+
+   // ------------------------ selectors for the columns and the values ------------------------------------
+   size_t maxLengthRet = std::max(maxLengthType + 21, "std::vector<std::uint64_t> const&"s.size() + 1);
+   os << my_indent(2) << "// columns with the values, rows without value contain the default value of the type\n";
+   for (auto const& [attr, dtype] : processing_data) {
+      out_format(os, "{0}{1:<{2}}{3}() const {{ return {4}; }}\n", my_indent(2), "std::vector<"s + dtype.SourceType() + "> const&"s,
+                                                                  maxLengthRet, attr.Name(), dtype.Prefix() + attr.Name());
+      }
+   os << "\n"
+      << my_indent(2) << "// validity bitmaps of the columns, bit iRow % 64 in the word iRow / 64\n";
+   for (size_t iAttr = 0; auto const& [attr, dtype] : processing_data) {
+      out_format(os, "{0}{1:<{2}}{3}_valid() const {{ return _present[{4}]; }}\n", my_indent(2), "std::vector<std::uint64_t> const&"s,
+                                                                                  maxLengthRet, attr.Name(), iAttr++);
+      }
+   os << "\n"
+      << my_indent(2) << "// selectors for the value of an attribute in a row\n";
+   for (size_t iAttr = 0; auto const& [attr, dtype] : processing_data) {
+      std::string strOptional = "std::optional<"s + dtype.SourceType() + ">"s;
+      out_format(os, "{0}{1:<{2}}{3}(std::size_t iRow) const {{ return _has_value({4}, iRow) ? {1}({5}[iRow]) : std::nullopt; }}\n",
+                     my_indent(2), strOptional, maxLengthRet, attr.Name(), iAttr, dtype.Prefix() + attr.Name());
+      out_format(os, "{0}{1:<{2}}_{3}(std::size_t iRow) const {{\n"
+                     "{6}if (_has_value({4}, iRow)) [[likely]] return {5}[iRow];\n"
+                     "{6}else throw std::runtime_error(\"value for attribute \\\"{3}\\\" in row \" + std::to_string(iRow) + \" of class \\\"{7}\\\" is empty.\");\n"
+                     "{6}}}\n",
+                     my_indent(2), dtype.SourceType() + (dtype.UseReference() ? " const&"s : ""s), maxLengthRet, attr.Name(), iAttr,
+                     dtype.Prefix() + attr.Name(), my_indent(3), ClassName());
+      ++iAttr;
+      }
+   os << "\n";
+
+   // ------------------------ internal functions ----------------------------------------------------------
+   os << "   private:\n"
+      << my_indent(2) << "bool _has_value(std::size_t iAttr, std::size_t iRow) const noexcept {\n"
+      << my_indent(3) << "return (_present[iAttr][iRow / 64] & (std::uint64_t { 1 } << (iRow % 64))) != 0;\n"
+      << my_indent(3) << "}\n\n"
+      << my_indent(2) << "template <typename ty>\n"
+      << my_indent(2) << "void _append(std::size_t iAttr, std::optional<ty> const& value, std::vector<ty>& column) {\n"
+      << my_indent(3) << "if (value) {\n"
+      << my_indent(4) << "column.push_back(*value);\n"
+      << my_indent(4) << "_present[iAttr][iRows / 64] |= std::uint64_t { 1 } << (iRows % 64);\n"
+      << my_indent(4) << "}\n"
+      << my_indent(3) << "else column.emplace_back();\n"
+      << my_indent(3) << "}\n"
+      << "   };\n\n";
+   }
+
+
 /*
  * \brief method to create the source file
  * \note alternative adding to the h file as inline code
@@ -609,12 +984,18 @@ bool TMyTable::CreateHeader(std::ostream& os) const {
 bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
    try {
       auto parents = References() | std::views::filter([](auto const& r) { return r.ReferenceType() == EMyReferenceType::generalization; })
-         | std::views::transform([this](auto const& r) { return Dictionary().FindTable(r.RefTable()); });
+         | std::views::transform([](auto const& r) -> TMyTable const& { return r.GetRefTable(); });
 
-      auto processing_data = Attributes() | std::views::transform([this](auto const& attr) {
-         return std::make_pair(attr, Dictionary().FindDataType(attr.DataType())); })
+      auto processing_data = Attributes() | std::views::transform([](auto const& attr) {
+         return std::make_pair(attr, attr.GetDataType()); })
          | std::ranges::to<std::vector>();
 
+      // layout with null bitmap, the bits in the sequence of the attributes like in CreateHeader
+      bool const boNullBitmap = Dictionary().RecordLayout() == EMyRecordLayout::null_bitmap;
+      auto null_bit = [&processing_data](TMyAttribute const& attr) -> size_t {
+         return static_cast<size_t>(std::ranges::find(processing_data, attr.Name(), [](auto const& p) -> std::string const& { return p.first.Name(); }) - processing_data.begin());
+         };
+
          auto maxElement = std::ranges::max_element(processing_data, [](auto const& a, auto const& b) {
             static auto constexpr len = [](auto const& e) { return e.second.Prefix().size() + e.first.Name().size(); };
             return len(a) < len(b);
@@ -634,12 +1015,13 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
          if (Dictionary().License().size() > 0)   os << "* " << Dictionary().License() << '\n';
          os << "*/\n\n";
 
-         os << std::format("#include {}\n\n", Include());
+         out_format(os, "#include {}\n\n", Include());
 
          os << "#include <typeinfo>\n\n";
 
          bool boHasNamespace = Namespace().size() > 0;
          auto prim_attr = processing_data | std::views::filter([](auto const& a) { return std::get<0>(a).Primary(); }) | std::ranges::to<std::vector>();
+         auto const packed_key = packed_key_layout(prim_attr);
          if (prim_attr.size() == 0) [[unlikely]]
             throw std::runtime_error(std::format("critical error: missing primary key for table \"{}\".", Name()));
          else {
@@ -674,7 +1056,7 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
             auto inherited = GetPart_ofs(EMyReferenceType::generalization);
             if (!inherited.empty()) {
                for (auto const& [table, _1, _2, _3, _4] : inherited) {
-                  os << std::format("#include {}\n", table.Include());
+                  out_format(os, "#include {}\n", table.Include());
                   }
                os << "\n";
                }
@@ -689,7 +1071,7 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
                << std::format("{0}::primary_key::primary_key() : ", ClassName())
                << std::get<1>(prim_attr[0]).Prefix() + std::get<0>(prim_attr[0]).Name() + " {}";
             for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
-               os << std::format(", {} {{}}", dtype.Prefix() + attr.Name());
+               out_format(os, ", {} {{}}", dtype.Prefix() + attr.Name());
                }
             os << " { }\n\n";
 
@@ -699,11 +1081,11 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
                                                                            (std::get<1>(prim_attr[0]).UseReference() ? " const&" : ""),
                                                                            std::get<0>(prim_attr[0]).Name());
             for (auto const& [attr, dtype] : prim_attr | std::views::drop(1))
-                  os << std::format(", {0}{1} p{2}", dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Name());
+                  out_format(os, ", {0}{1} p{2}", dtype.SourceType(), (dtype.UseReference() ? " const&" : ""), attr.Name());
             os << ") : " << std::format("{0}(p{1})", strAttr, std::get<0>(prim_attr[0]).Name());
             for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
                std::string strAttr = dtype.Prefix() + attr.Name();
-               os << std::format(", {0}(p{1})", strAttr, attr.Name());
+               out_format(os, ", {0}(p{1})", strAttr, attr.Name());
                }
             os << " { }\n\n";
 
@@ -711,39 +1093,49 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
             os << std::format("{0}::primary_key::primary_key({0} const& other) : {1}(other._{2}())", ClassName(), strAttr,
                                                                                                      std::get<0>(prim_attr[0]).Name());
             for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
-               os << std::format(", {0}(other._{1}())", dtype.Prefix() + attr.Name(), attr.Name());
+               out_format(os, ", {0}(other._{1}())", dtype.Prefix() + attr.Name(), attr.Name());
                }
             os << " { }\n\n";
 
             // copy constructor for the primary_key type
-            os << std::format("{0}::primary_key::primary_key({0}::primary_key const& other) : {1}(other.{1})", ClassName(), strAttr);
+            out_format(os, "{0}::primary_key::primary_key({0}::primary_key const& other) : {1}(other.{1})", ClassName(), strAttr);
             for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
                std::string strAttr = dtype.Prefix() + attr.Name();
-               os << std::format(", {0}(other.{0})", strAttr);
+               out_format(os, ", {0}(other.{0})", strAttr);
                }
             os << " { }\n\n";
 
             // move constructor for the primary_key type
             // strAttr initialized still from copy constructor
-            os << std::format("{0}::primary_key::primary_key(primary_key&& other) noexcept : {1}(std::move(other.{1}))", ClassName(), strAttr);
+            out_format(os, "{0}::primary_key::primary_key(primary_key&& other) noexcept : {1}(std::move(other.{1}))", ClassName(), strAttr);
             for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
                std::string strAttr = dtype.Prefix() + attr.Name();
-               os << std::format(", {0}(std::move(other.{0}))", strAttr);
+               out_format(os, ", {0}(std::move(other.{0}))", strAttr);
                }
             os << " { }\n\n";
 
+            // copy assignment for the primary_key type
+            out_format(os, "{0}::primary_key& {0}::primary_key::operator = (primary_key const& other) {{\n", ClassName());
+            for (auto const& [attr, dtype] : prim_attr) out_format(os, "{0}{1} = other.{1};\n", my_indent(1), dtype.Prefix() + attr.Name());
+            out_format(os, "{0}return *this;\n{0}}}\n\n", my_indent(1));
+
+            // move assignment for the primary_key type
+            out_format(os, "{0}::primary_key& {0}::primary_key::operator = (primary_key&& other) noexcept {{\n", ClassName());
+            for (auto const& [attr, dtype] : prim_attr) out_format(os, "{0}{1} = std::move(other.{1});\n", my_indent(1), dtype.Prefix() + attr.Name());
+            out_format(os, "{0}return *this;\n{0}}}\n\n", my_indent(1));
+
             // constructors for class which dependent of this class
             if (!inherited.empty()) {
                for (auto const& [table, type_name, var_name, key_val, key_pairs] : inherited) {
                   std::string const& strPrimAttr = FindAttribute(key_pairs[0].first).Name();
-                  std::string const& strPrimAttrPrefix = Dictionary().FindDataType(FindAttribute(key_pairs[0].first).DataType()).Prefix();
+                  std::string const& strPrimAttrPrefix = FindAttribute(key_pairs[0].first).GetDataType().Prefix();
                   os << std::format("{0}::primary_key::primary_key({1} const& other) : {2}{3}(other._{4}())", ClassName(), table.FullClassName(),
                                                                                                  strPrimAttrPrefix, strPrimAttr,
                                                                                               table.FindAttribute(key_pairs[0].second).Name());
                   for (auto const& [parent_id, inherited_id] : key_pairs | std::views::drop(1)) {
                      std::string const& strPrimAttr = FindAttribute(parent_id).Name();
-                     std::string const& strPrimAttrPrefix = Dictionary().FindDataType(FindAttribute(parent_id).DataType()).Prefix();
-                     os << std::format(", {0}{1}(other._{2}())", strPrimAttrPrefix, strPrimAttr, table.FindAttribute(inherited_id).Name());
+                     std::string const& strPrimAttrPrefix = FindAttribute(parent_id).GetDataType().Prefix();
+                     out_format(os, ", {0}{1}(other._{2}())", strPrimAttrPrefix, strPrimAttr, table.FindAttribute(inherited_id).Name());
                      }
                   os << " { }\n\n";
                   }
@@ -780,15 +1172,49 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
                << my_indent(1) << "}\n\n";
             */
 
-            os << std::format("int {0}::primary_key::_compare(primary_key const& other) const {{\n", ClassName())
-               << my_indent(1) << "static auto constexpr comp_help = [](auto const& lhs, auto const& rhs) -> int {\n"
-               << my_indent(2) << "return (lhs < rhs ? -1 : (lhs > rhs ? 1 : 0));\n"
-               << my_indent(2) << "};\n\n";
+            os << std::format("int {0}::primary_key::_compare(primary_key const& other) const {{\n", ClassName());
+            if (!packed_key.empty()) {
+               os << my_indent(1) << "auto const lhs = _packed(), rhs = other._packed();\n"
+                  << my_indent(1) << "return (lhs < rhs ? -1 : (lhs > rhs ? 1 : 0));\n"
+                  << my_indent(1) << "}\n\n";
+               }
+            else {
+               os << my_indent(1) << "static auto constexpr comp_help = [](auto const& lhs, auto const& rhs) -> int {\n"
+                  << my_indent(2) << "return (lhs < rhs ? -1 : (lhs > rhs ? 1 : 0));\n"
+                  << my_indent(2) << "};\n\n";
 
-            for (auto const& [attr, dtype] : prim_attr) {
-               os << std::format("{0}if(auto ret = comp_help(this->{1}, other.{1}); ret != 0) return ret;\n", my_indent(1), dtype.Prefix() + attr.Name());
-            }
-            os << my_indent(1) << "return 0;\n"
+               for (auto const& [attr, dtype] : prim_attr) {
+                  out_format(os, "{0}if(auto ret = comp_help(this->{1}, other.{1}); ret != 0) return ret;\n", my_indent(1), dtype.Prefix() + attr.Name());
+               }
+               os << my_indent(1) << "return 0;\n"
+                  << my_indent(1) << "}\n\n";
+               }
+
+            // the attributes are combined with the finalizer of splitmix64, composed integer keys like (ID, year)
+            // spread over all bits and a hash table with a power of two slots can use the low or high bits
+            os << "// hash value for this primary_key element\n"
+               << std::format("std::size_t {0}::primary_key::hash() const {{\n", ClassName())
+               << my_indent(1) << "static auto constexpr mix = [](std::uint64_t value) -> std::uint64_t {\n"
+               << my_indent(2) << "value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;\n"
+               << my_indent(2) << "value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;\n"
+               << my_indent(2) << "return value ^ (value >> 31);\n"
+               << my_indent(2) << "};\n\n"
+               << my_indent(1) << "std::uint64_t ret = 0;\n";
+            if (packed_key.empty()) {
+               for (auto const& [attr, dtype] : prim_attr) {
+                  out_format(os, "{0}ret = mix(ret ^ ({1} + 0x9e3779b97f4a7c15ull));\n", my_indent(1),
+                                 source_type_hash(dtype.SourceType(), "this->"s + dtype.Prefix() + attr.Name()));
+                  }
+               }
+            else if (packed_key.back().iWord == 0) {
+               out_format(os, "{0}ret = mix(ret ^ (_packed() + 0x9e3779b97f4a7c15ull));\n", my_indent(1));
+               }
+            else {
+               out_format(os, "{0}auto const [high, low] = _packed();\n"
+                              "{0}ret = mix(ret ^ (high + 0x9e3779b97f4a7c15ull));\n"
+                              "{0}ret = mix(ret ^ (low + 0x9e3779b97f4a7c15ull));\n", my_indent(1));
+               }
+            os << my_indent(1) << "return static_cast<std::size_t>(ret);\n"
                << my_indent(1) << "}\n\n";
             
             }  // possible to move this bracket deeper because an exception thrown
@@ -842,12 +1268,23 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
 
 
          // create an initialize operator for the primary_key class
-         os << std::format("{0}::{0}(primary_key const& other) : {1}(other.{2}())", ClassName(), 
-                             std::get<1>(prim_attr[0]).Prefix() + std::get<0>(prim_attr[0]).Name(), std::get<0>(prim_attr[0]).Name());
-         for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
-            os << std::format(", {0}(other.{1}())", dtype.Prefix() + attr.Name(), attr.Name());
-         }
-         os << " { }\n\n";
+         if (!boNullBitmap) {
+            os << std::format("{0}::{0}(primary_key const& other) : {1}(other.{2}())", ClassName(), 
+                                std::get<1>(prim_attr[0]).Prefix() + std::get<0>(prim_attr[0]).Name(), std::get<0>(prim_attr[0]).Name());
+            for (auto const& [attr, dtype] : prim_attr | std::views::drop(1)) {
+               out_format(os, ", {0}(other.{1}())", dtype.Prefix() + attr.Name(), attr.Name());
+            }
+            os << " { }\n\n";
+            }
+         else {
+            // the members are in the sequence of the alignment, the key attributes are assigned with their bit
+            os << std::format("{0}::{0}(primary_key const& other) {{\n", ClassName());
+            for (auto const& [attr, dtype] : prim_attr) {
+               out_format(os, "{0}{1:<{2}} = other.{3}(); _has_value({4}, true);\n", my_indent(1), dtype.Prefix() + attr.Name(), maxLengthAttr,
+                                                                                  attr.Name(), null_bit(attr));
+               }
+            os << my_indent(1) << "}\n\n";
+            }
 
 
          // -------------------- create the destructor ------------------------------------------
@@ -925,7 +1362,7 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
             << std::format("{0}& {0}::init(primary_key const& key_values) {{\n", ClassName())
             << my_indent(1) << "init();\n";
          for (auto const& [attr, _] : processing_data | std::views::filter([](auto const& p) { return std::get<0>(p).Primary(); })) {
-            os << std::format("{0}{1}(key_values.{1}());\n", my_indent(1), attr.Name());
+            out_format(os, "{0}{1}(key_values.{1}());\n", my_indent(1), attr.Name());
             }
          os << my_indent(1) << "return *this;\n"
             << my_indent(1) << "}\n"
@@ -948,10 +1385,11 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
             << "void " << ClassName() << "::_swap(" << ClassName() << "& other) noexcept {\n";
          os << "   // swapping own data elements\n";
          for (auto const& [attr, dtype] : processing_data) os << std::format("   std::swap({0}, other.{0});\n", dtype.Prefix() + attr.Name());
+         if (boNullBitmap) os << "   std::swap(_present, other._present);\n";
          if (!part_of_data.empty()) {
             os << "   // swapping the composed classes\n";
             std::ranges::for_each(part_of_data, [&os, maxLength](auto const& p) {
-               os << std::format("   std::swap({0}, other.{0});\n", std::get<2>(p));
+               out_format(os, "   std::swap({0}, other.{0});\n", std::get<2>(p));
                });
          }
 
@@ -963,14 +1401,25 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
             << "void " << ClassName() << "::_init() {\n";
          os << "   // initializing own data elements\n";
          auto maxSize = std::max(maxLengthAttr, maxLength);
-         for (auto const& [attr, dtype] : processing_data) {
-            std::string strAttribute = dtype.Prefix() + attr.Name();
-            os << std::format("   {0:<{1}} = {2};\n", strAttribute, maxSize, (attr.InitSeq().size() > 0 ? attr.InitSeq() : "{}"s));
+         if (!boNullBitmap) {
+            for (auto const& [attr, dtype] : processing_data) {
+               std::string strAttribute = dtype.Prefix() + attr.Name();
+               out_format(os, "   {0:<{1}} = {2};\n", strAttribute, maxSize, (attr.InitSeq().size() > 0 ? attr.InitSeq() : "{}"s));
+               }
+            }
+         else {
+            // attributes without init sequence are NULL like an empty std::optional
+            out_format(os, "   {0:<{1}} = {{ }};\n", "_present"s, maxSize);
+            for (auto const& [attr, dtype] : processing_data) {
+               std::string strAttribute = dtype.Prefix() + attr.Name();
+               if (attr.InitSeq().size() > 0) out_format(os, "   {0:<{1}} = {2}; _has_value({3}, true);\n", strAttribute, maxSize, attr.InitSeq(), null_bit(attr));
+               else out_format(os, "   {0:<{1}} = {{ }};\n", strAttribute, maxSize);
+               }
             }
          if (!part_of_data.empty()) {
             os << "   // initializing the composed classes\n";
             std::ranges::for_each(part_of_data, [&os, maxSize](auto const& p) {
-               os << std::format("   {0:<{1}} = {{ }};\n", std::get<2>(p), maxSize);
+               out_format(os, "   {0:<{1}} = {{ }};\n", std::get<2>(p), maxSize);
                });
             }
          os << "   return;\n"
@@ -979,11 +1428,18 @@ bool TMyTable::CreateSource(std::ostream& os, bool boInline) const {
 
          os << "// _copy: internal copy method for the class\n"
             << "void " << ClassName() << "::_copy(" << ClassName() << " const& other) {\n";
-         for (auto const& [attr, dtype] : processing_data) os << std::format("   {0}(other.{0}());\n", attr.Name());
+         if (!boNullBitmap) {
+            for (auto const& [attr, dtype] : processing_data) os << std::format("   {0}(other.{0}());\n", attr.Name());
+            }
+         else {
+            // direct copy of the members with the bitmap, without the conversion to std::optional
+            for (auto const& [attr, dtype] : processing_data) out_format(os, "   {0:<{1}} = other.{0};\n", dtype.Prefix() + attr.Name(), maxLengthAttr);
+            out_format(os, "   {0:<{1}} = other.{0};\n", "_present"s, maxLengthAttr);
+            }
          if (!part_of_data.empty()) {
             os << "   // copying the composed classes\n";
             std::ranges::for_each(part_of_data, [&os, maxLength](auto const& p) {
-               os << std::format("   {0:<{1}} = other.{0};\n", std::get<2>(p), maxLength);
+               out_format(os, "   {0:<{1}} = other.{0};\n", std::get<2>(p), maxLength);
                });
             }
          os << "   return;\n"
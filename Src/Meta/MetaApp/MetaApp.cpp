@@ -14,6 +14,8 @@
 
 #include "Berlin_Dictionary.h"
 #include "Test_Dictionary.h"
+#include "MyModelLoader.h"
+#include "MyModelWatcher.h"
 
 #include <iostream>
 #include <iomanip>
@@ -39,8 +41,26 @@ void Test(TMyDictionary const& dictionary) {
    } 
 
 
-int main() {
+int main(int argc, char* argv[]) {
    try {
+      // with a model file as argument the model is loaded without a new build, paths are part of the model file
+      // an optional second argument is a snapshot file as cache for the next start with the same model
+      // with --watch before the model file the generator stays resident and creates the affected files after every change
+      if (argc > 2 && std::string_view(argv[1]) == "--watch") {
+         TMyModelWatcher watcher(argv[2]);
+         std::cout << "watch model " << argv[2] << ", stop with Ctrl+C\n";
+         watcher.Run(std::stop_token { });
+         return 0;
+         }
+      else if (argc > 1) {
+         TMyDictionary dictionary;
+         if (argc > 2) LoadModelFile(dictionary, argv[1], argv[2]);
+         else LoadModelFile(dictionary, argv[1]);
+         dictionary.Create_All(std::cout, std::cerr);
+         std::cout << "\n\ngenerator finished without error\n";
+         return 0;
+         }
+
       TDictionary_Test dict_data;
   
       /// defining the paths for the output during metadata processing
@@ -57,6 +77,7 @@ int main() {
       dict_data.Dictionary().DocPath("D:\\Projekte\\GitHub\\Test_Metadata_Creator\\Documentation");
       dict_data.Dictionary().IDLPath("D:\\Projekte\\GitHub\\Test_Metadata_Creator\\IDL");
       dict_data.Dictionary().CorbaPath("D:\\Projekte\\GitHub\\Test_Metadata_Creator\\src\\Corba");
+      dict_data.Dictionary().ManifestFile("D:\\Projekte\\GitHub\\Test_Metadata_Creator\\generator.manifest");
 
       constexpr bool boTest = false;
 
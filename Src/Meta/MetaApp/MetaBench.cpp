@@ -0,0 +1,560 @@
+/** \file
+   \brief benchmark for the metadata generator with synthetic models
+   \details the benchmark creates a synthetic model as model file text (see MyModelLoader.h) with a configurable
+            count of tables, attributes per table, density of associations, depth of compositions and count of
+            indices. the model is loaded and every phase of the generator is measured separately, the generators
+            write into memory, so the results are free of disk noise. the phase create_all_memory runs the complete
+            Create_All with all worker threads into a TMyMemoryOutput, the phase watch_attribute adds one attribute
+            to the last table and measures the resident TMyModelWatcher, which creates only the affected files.
+            only the phase create_all writes files.
+            the phases sql_<kind> build every kind of sql statements separately with an empty cache, the phases
+            stream_text_buffer and stream_ostringstream write the same sources into TMyTextStream and into
+            std::ostringstream to compare the throughput of the streams. the section arena contains the count of
+            texts, the characters and the blocks of the string arena of the dictionary after all phases.
+            the results are written as JSON, so they can be compared between versions.
+   \code
+   MetaBench --tables 2000 --attributes 20 --references 0.3 --depth 2 --indices 2 --repeat 3 --output result.json
+   \endcode
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to measure the generator and to detect regressions
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "DataDictionary.h"
+#include "DictionaryHelper.h"
+#include "MyModelLoader.h"
+#include "MyUTF8Stream.h"
+#include "MyTextBuffer.h"
+#include "MyMemoryOutput.h"
+#include "MyModelWatcher.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <map>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <format>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+   #define WIN32_LEAN_AND_MEAN
+   #define NOMINMAX
+   #include <windows.h>
+   #include <psapi.h>
+#else
+   #include <sys/resource.h>
+#endif
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+// ------------------------------------------------------------------------------------------------
+// count of allocations for the phases, all other forms of new and delete use these two functions
+namespace {
+   std::atomic<size_t> iAllocations     = 0;
+   std::atomic<size_t> iAllocatedBytes  = 0;
+   }
+
+void* operator new(std::size_t size) {
+   iAllocations.fetch_add(1, std::memory_order_relaxed);
+   iAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+   if (void* ptr = std::malloc(size > 0 ? size : 1); ptr != nullptr) [[likely]] return ptr;
+   throw std::bad_alloc();
+   }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+
+namespace {
+
+   /// \brief parameters of the synthetic model and the measurement
+   struct my_bench_config {
+      size_t       iTables     = 500;     ///< count of tables
+      size_t       iAttributes = 12;      ///< attributes per table without the key attributes
+      double       flReferences = 0.3;    ///< probability of an association to an earlier table for every table
+      size_t       iDepth      = 2;       ///< depth of compositions, 0 without compositions
+      size_t       iIndices    = 1;       ///< indices per table
+      size_t       iRepeat     = 3;       ///< runs of every phase
+      unsigned int iThreads    = 0;       ///< threads for create_all, 0 = hardware concurrency
+      uint64_t     iSeed       = 4711;    ///< start value for the random numbers, same value creates the same model
+      bool         boFiles     = false;   ///< measure create_all with files in directory
+      fs::path     directory   = fs::temp_directory_path() / "MetaBench";  ///< target for files of create_all and the snapshot
+      fs::path     output;                ///< file for the JSON result, empty for std::cout
+      };
+
+   /// \brief result of a phase, times of all runs and counters of the last run
+   struct my_phase_result {
+      std::string         strName;
+      std::vector<double> times;           ///< wall time of every run in ms
+      size_t              iBytes = 0;      ///< generated bytes
+      size_t              iFiles = 0;      ///< generated files / texts
+      size_t              iAllocations = 0;
+      size_t              iAllocatedBytes = 0;
+      };
+
+   /// \brief output of a phase
+   struct my_phase_output {
+      size_t iBytes = 0;
+      size_t iFiles = 0;
+      };
+
+   struct my_datatype_use {
+      std::string_view strDataType;
+      size_t           iLen;
+      size_t           iScale;
+      };
+
+   constexpr auto attribute_types = std::to_array<my_datatype_use>({
+      { "varchar"sv, 50, 0 }, { "decimal"sv, 12, 2 }, { "date"sv, 0, 0 }, { "bool"sv, 0, 0 },
+      { "integer"sv, 0, 0 }, { "text"sv, 0, 0 }, { "bigint"sv, 0, 0 } });
+
+   std::string TableName(size_t iTable) { return std::format("Table{:05}", iTable); }
+
+   /// \brief text of the synthetic model, the same config creates always the same model
+   std::string CreateModelText(my_bench_config const& config) {
+      std::string text;
+      auto line = [&text]<typename... args_ty>(std::format_string<args_ty...> fmt, args_ty&&... args) {
+         std::format_to(std::back_inserter(text), fmt, std::forward<args_ty>(args)...);
+         text.push_back('\n');
+         };
+
+      line("# synthetic model for MetaBench");
+      line("Name \"synthetic benchmark model\"");
+      line("Denotation \"synthetic model with {} tables\"", config.iTables);
+      line("Version \"1.0\"");
+      line("Author \"MetaBench\"");
+      line("Copyright \"adecc Systemhaus GmbH 2024, All rights reserved.\"");
+      line("License \"This project is released under the MIT License.\"");
+      line("BaseClass TBenchBase");
+      line("BaseNamespace myBench");
+      line("PathToBase Base");
+      line("PersistenceClass TBenchReader");
+      line("PersistenceName bench_reader");
+      line("PersistenceNamespace reader");
+      line("PersistenceServerType TMyMSSQL");
+      line("PersistenceDatabase Bench");
+
+      line("AddDataType bigint BIGINT false false false \"\" \"long long\" \"\" i \"long long\" \"\" false \"8 byte integer\"");
+      line("AddDataType bool TINYINT false false false \"IN (0, 1)\" bool \"\" bo boolean \"\" false \"boolean value\"");
+      line("AddDataType date DATE false false false \"\" std::chrono::year_month_day <chrono> da BasicModule::YearMonthDay Basic.idl false \"date\"");
+      line("AddDataType decimal DECIMAL true true false \"\" double \"\" fl double \"\" true \"exact number with precision and scale\"");
+      line("AddDataType integer INT false false false \"\" int \"\" i long \"\" false \"4 byte integer\"");
+      line("AddDataType text VARCHAR(MAX) false false true \"\" std::string <string> str string \"\" true \"large text\"");
+      line("AddDataType varchar VARCHAR true false true \"\" std::string <string> str string \"\" true \"text with variable length\"");
+
+      line("AddNameSpace myBench BenchModule \"namespace of the synthetic model\" \"classes of the synthetic model\" \"created by MetaBench\"");
+      line("AddDirectory Bench \"directory of the synthetic model\" \"header and source files of the synthetic model\"");
+
+      std::mt19937_64 random(config.iSeed);
+      std::uniform_real_distribution<double> probability(0.0, 1.0);
+      std::vector<size_t> roots;   // tables without composition, targets for associations
+
+      for (size_t iTable = 0; iTable < config.iTables; ++iTable) {
+         auto const strTable = TableName(iTable);
+         size_t const iLevel = config.iDepth > 0 ? iTable % (config.iDepth + 1) : 0;
+         line("AddTable {0} table {0} dbo {0} myBench Bench SQL \"synthetic table {1} at level {2}\"", strTable, iTable, iLevel);
+         line("   AddDescription \"table {} of the synthetic model, it is used to measure the generators with many tables and attributes\"", strTable);
+
+         int iID = 0;
+         for (size_t iKey = 0; iKey <= iLevel; ++iKey, ++iID)
+            line("   AddAttribute {0} Key{1} Key{1} integer 0 0 true true \"\" \"\" \"\" \"key attribute {1} of {2}\"", iID + 1, iKey, strTable);
+
+         for (size_t iAttr = 0; iAttr < config.iAttributes; ++iAttr, ++iID) {
+            auto const& type = attribute_types[iAttr % attribute_types.size()];
+            line("   AddAttribute {0} Value{1} Value{1} {2} {3} {4} {5} false \"\" \"\" \"\" \"value {1} of {6}\"",
+                 iID + 1, iAttr, type.strDataType, type.iLen, type.iScale, iAttr % 2 == 0 ? "true"sv : "false"sv, strTable);
+            }
+
+         if (iLevel > 0) {
+            auto const strParent = TableName(iTable - 1);
+            text.append(std::format("   AddReference {0}2{1} composition {1} \"part of\" \"1 : n\" - \"composition in the synthetic model\"", strTable, strParent));
+            for (size_t iKey = 1; iKey <= iLevel; ++iKey) text.append(std::format(" {0}:{0}", iKey));
+            text.push_back('\n');
+            }
+         else roots.emplace_back(iTable);
+
+         if (roots.size() > 1 && probability(random) < config.flReferences) {
+            auto const iTarget = roots[std::uniform_int_distribution<size_t>(0, roots.size() - 2)(random)];
+            line("   AddAttribute {0} Ref{1} Ref{1} integer 0 0 false false \"\" \"\" \"\" \"reference to {2}\"", ++iID, iTarget, TableName(iTarget));
+            line("   AddReference {0}2{1} assoziation {1} \"belongs to\" \"1 : n\" - \"association in the synthetic model\" {2}:1", strTable, TableName(iTarget), iID);
+            }
+
+         for (size_t iIdx = 0; iIdx < std::min(config.iIndices, config.iAttributes); ++iIdx)  // index on attribute Value{iIdx}
+            line("   AddIndex {0}_Idx{1} undefined \"access path {1}\" {2}:true", strTable, iIdx, iLevel + 2 + iIdx);
+         }
+      return text;
+      }
+
+   size_t PeakRSS() {
+   #if defined(_WIN32)
+      PROCESS_MEMORY_COUNTERS counters;
+      if (::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters))) return counters.PeakWorkingSetSize;
+      return 0;
+   #else
+      rusage usage;
+      if (::getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+      #if defined(__APPLE__)
+         return static_cast<size_t>(usage.ru_maxrss);
+      #else
+         return static_cast<size_t>(usage.ru_maxrss) * 1024;
+      #endif
+   #endif
+      }
+
+   /// \brief render a generator into memory, like the files in Create_All
+   template <typename stream_ty = TMyUTF8Stream>
+   void Render(my_phase_output& output, std::function<void (std::ostream&)> const& func) {
+      stream_ty os;
+      func(os);
+      if constexpr (std::is_same_v<stream_ty, TMyUTF8Stream>) output.iBytes += os.Finish().Size();
+      else if constexpr (std::is_same_v<stream_ty, std::ostringstream>) output.iBytes += os.view().size();
+      else output.iBytes += os.Text().Size();
+      ++output.iFiles;
+      }
+
+   class TMyBenchmark {
+      my_bench_config                const& config;
+      std::vector<my_phase_result>          results;
+   public:
+      explicit TMyBenchmark(my_bench_config const& pConfig) : config(pConfig) { }
+
+      std::vector<my_phase_result> const& Results() const { return results; }
+
+      /// \brief run the phase config.iRepeat times, prepare is called before every run without measurement
+      void Measure(std::string const& strName, std::function<my_phase_output ()> const& phase, std::function<void ()> const& prepare = { }) {
+         my_phase_result result { strName };
+         for (size_t iRun = 0; iRun < std::max<size_t>(config.iRepeat, 1); ++iRun) {
+            if (prepare) prepare();
+            auto const iAllocStart = iAllocations.load();
+            auto const iBytesStart = iAllocatedBytes.load();
+            auto const start = std::chrono::steady_clock::now();
+            auto const output = phase();
+            auto const stop = std::chrono::steady_clock::now();
+            result.times.emplace_back(std::chrono::duration<double, std::milli>(stop - start).count());
+            result.iBytes = output.iBytes;
+            result.iFiles = output.iFiles;
+            result.iAllocations = iAllocations.load() - iAllocStart;
+            result.iAllocatedBytes = iAllocatedBytes.load() - iBytesStart;
+            }
+         std::cerr << std::format("{:<26} {:>10.3f} ms\n", strName, std::ranges::min(result.times));
+         results.emplace_back(std::move(result));
+         }
+      };
+
+   void WriteJSON(std::ostream& os, my_bench_config const& config, TMyDictionary const& dictionary, size_t iModelBytes,
+                  std::vector<my_phase_result> const& results) {
+      size_t iAttributes = 0, iReferences = 0, iIndices = 0;
+      for (auto const& [name, table] : dictionary.Tables()) {
+         iAttributes += table.Attributes().size();
+         iReferences += table.References().size();
+         iIndices    += table.Indices().size();
+         }
+
+      os << "{\n"
+         << "  \"benchmark\": \"MetaBench\",\n"
+         << "  \"config\": {\n"
+         << std::format("    \"tables\": {}, \"attributes\": {}, \"references\": {}, \"depth\": {}, \"indices\": {},\n",
+                        config.iTables, config.iAttributes, config.flReferences, config.iDepth, config.iIndices)
+         << std::format("    \"repeat\": {}, \"threads\": {}, \"seed\": {}, \"files\": {}\n",
+                        config.iRepeat, config.iThreads, config.iSeed, config.boFiles)
+         << "  },\n"
+         << "  \"model\": {\n"
+         << std::format("    \"tables\": {}, \"attributes\": {}, \"references\": {}, \"indices\": {}, \"model_bytes\": {}\n",
+                        dictionary.Tables().size(), iAttributes, iReferences, iIndices, iModelBytes)
+         << "  },\n"
+         << "  \"arena\": {\n"
+         << std::format("    \"texts\": {}, \"bytes\": {}, \"blocks\": {}\n",
+                        dictionary.Texts().Size(), dictionary.Texts().Bytes(), dictionary.Texts().Blocks())
+         << "  },\n"
+         << "  \"phases\": [\n";
+      for (size_t i = 0; i < results.size(); ++i) {
+         auto const& result = results[i];
+         double const flMin  = std::ranges::min(result.times);
+         double const flMean = std::accumulate(result.times.begin(), result.times.end(), 0.0) / result.times.size();
+         double const flSeconds = flMin / 1000.0;
+         os << std::format("    {{ \"name\": \"{}\", \"runs\": {}, \"min_ms\": {:.3f}, \"mean_ms\": {:.3f}, \"bytes\": {}, \"files\": {}, "
+                           "\"allocations\": {}, \"allocated_bytes\": {}, \"tables_per_s\": {:.1f}, \"mb_per_s\": {:.2f} }}{}\n",
+                           result.strName, result.times.size(), flMin, flMean, result.iBytes, result.iFiles,
+                           result.iAllocations, result.iAllocatedBytes,
+                           flSeconds > 0.0 ? dictionary.Tables().size() / flSeconds : 0.0,
+                           flSeconds > 0.0 ? result.iBytes / (1024.0 * 1024.0) / flSeconds : 0.0,
+                           i + 1 < results.size() ? "," : "");
+         }
+      os << "  ],\n"
+         << std::format("  \"peak_rss_bytes\": {}\n", PeakRSS())
+         << "}\n";
+      }
+
+   my_bench_config ReadArguments(int argc, char* argv[]) {
+      my_bench_config config;
+      for (int i = 1; i < argc; ++i) {
+         std::string_view const arg = argv[i];
+         if (arg == "--files"sv) { config.boFiles = true; continue; }
+         if (i + 1 >= argc) [[unlikely]] throw std::runtime_error("missing value for argument \""s + std::string(arg) + "\"."s);
+         std::string const value = argv[++i];
+         if      (arg == "--tables"sv)     config.iTables      = std::stoull(value);
+         else if (arg == "--attributes"sv) config.iAttributes  = std::stoull(value);
+         else if (arg == "--references"sv) config.flReferences = std::stod(value);
+         else if (arg == "--depth"sv)      config.iDepth       = std::stoull(value);
+         else if (arg == "--indices"sv)    config.iIndices     = std::stoull(value);
+         else if (arg == "--repeat"sv)     config.iRepeat      = std::stoull(value);
+         else if (arg == "--threads"sv)    config.iThreads     = static_cast<unsigned int>(std::stoul(value));
+         else if (arg == "--seed"sv)       config.iSeed        = std::stoull(value);
+         else if (arg == "--dir"sv)        config.directory    = value;
+         else if (arg == "--output"sv)     config.output       = value;
+         else [[unlikely]] throw std::runtime_error("unknown argument \""s + std::string(arg) + "\"."s);
+         }
+      return config;
+      }
+   }
+
+
+int main(int argc, char* argv[]) {
+   try {
+      auto const config = ReadArguments(argc, argv);
+      auto const strModel = CreateModelText(config);
+      TMyBenchmark bench(config);
+
+      std::unique_ptr<TMyDictionary> dictionary;
+      bench.Measure("load_model", [&]() {
+         dictionary = std::make_unique<TMyDictionary>();
+         LoadModelText(*dictionary, strModel, "synthetic.model"s);
+         return my_phase_output { strModel.size(), 1 };
+         }, [&]() { dictionary.reset(); });
+
+      auto& dict = *dictionary;
+      dict.Threads(config.iThreads);
+      dict.SourcePath(config.directory / "src");
+      dict.SQLPath(config.directory / "SQL");
+      dict.DocPath(config.directory / "Documentation");
+      dict.IDLPath(config.directory / "IDL");
+      dict.CorbaPath(config.directory / "src" / "Corba");
+
+      bench.Measure("link", [&]() { dict.Link(); return my_phase_output { }; }, [&]() { dict.Unlink(); });
+
+      bench.Measure("find_attribute", [&]() {
+         my_phase_output output;
+         for (auto const& [name, table] : dict.Tables()) {
+            for (auto const& attr : table.Attributes()) {
+               output.iBytes += table.FindAttribute(attr.Name()).ID() == attr.ID();
+               output.iBytes += table.FindAttribute(attr.ID()).ID() == attr.ID();
+               }
+            }
+         return output;
+         });
+
+      // every kind of statements separately, the cache is empty before every run
+      auto const& sql = dict.sql_builder();
+      auto is_table = [](TMyTable const& table) { return table.EntityType() != EMyEntityType::view; };
+      auto is_view  = [](TMyTable const& table) { return table.EntityType() == EMyEntityType::view; };
+      auto is_any   = [](TMyTable const&) { return true; };
+      auto measure_sql = [&](std::string const& strName, std::function<bool (TMyTable const&)> const& use,
+                             std::function<void (TMyTable const&, std::ostream&)> const& write) {
+         bench.Measure(strName, [&]() {
+            my_phase_output output;
+            Render<TMyTextStream>(output, [&](std::ostream& os) {
+               for (auto const& [name, table] : dict.Tables()) if (use(table)) write(table, os);
+               });
+            return output;
+            }, [&sql]() { sql.ClearStatements(); });
+         };
+
+      measure_sql("sql_create_table", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteCreateTable(table, os); });
+      measure_sql("sql_create_view", is_view, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteCreateView(table, os); });
+      measure_sql("sql_alter_table", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteAlterTable(table, os); });
+      measure_sql("sql_primary_key", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WritePrimaryKey(table, os); });
+      measure_sql("sql_foreign_keys", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteForeignKeys(table, os); });
+      measure_sql("sql_unique_keys", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteUniqueKeys(table, os); });
+      measure_sql("sql_indices", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteCreateIndices(table, os); });
+      measure_sql("sql_check_conditions", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteCreateCheckConditions(table, os); });
+      measure_sql("sql_range_values", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteRangeValues(table, os); });
+      measure_sql("sql_post_conditions", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteCreatePostConditions(table, os); });
+      measure_sql("sql_cleaning", is_table, [&sql](TMyTable const& table, std::ostream& os) { sql.WriteCreateCleaning(table, os); });
+      measure_sql("sql_select_all", is_any, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::SelectAll>(table, os);
+         });
+      measure_sql("sql_select_prim", is_any, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::SelectPrim>(table, os);
+         });
+      measure_sql("sql_select_unique", is_any, [&sql](TMyTable const& table, std::ostream& os) {
+         for (auto const& idx : table.Indices() | own::views::is_unique_key) sql.WriteQuerySource<EQueryType::SelectUnique>(table, idx, os);
+         });
+      measure_sql("sql_select_index", is_any, [&sql](TMyTable const& table, std::ostream& os) {
+         for (auto const& idx : table.Indices() | own::views::is_index) sql.WriteQuerySource<EQueryType::SelectIdx>(table, idx, os);
+         });
+      measure_sql("sql_select_relation", is_any, [&sql](TMyTable const& table, std::ostream& os) {
+         for (auto const& ref : table.References()) sql.WriteQuerySource<EQueryType::SelectRelation>(table, ref, os);
+         });
+      measure_sql("sql_select_rev_relation", is_any, [&sql](TMyTable const& table, std::ostream& os) {
+         for (auto const& ref : table.References()) sql.WriteQuerySource<EQueryType::SelectRevRelation>(table, ref, os);
+         });
+      measure_sql("sql_insert", is_table, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::Insert>(table, os);
+         });
+      measure_sql("sql_update_all", is_table, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::UpdateAll>(table, os);
+         });
+      measure_sql("sql_update_without_prims", is_table, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::UpdateWithoutPrims>(table, os);
+         });
+      measure_sql("sql_delete_all", is_table, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::DeleteAll>(table, os);
+         });
+      measure_sql("sql_delete_prim", is_table, [&sql](TMyTable const& table, std::ostream& os) {
+         sql.WriteQuerySource<EQueryType::DeletePrim>(table, os);
+         });
+
+      bench.Measure("sql_statements", [&]() {
+         for (auto const& [name, table] : dict.Tables()) dict.sql_builder().PrepareStatements(table);
+         return my_phase_output { 0, dict.Tables().size() };
+         }, [&]() { dict.sql_builder().ClearStatements(); });
+
+      bench.Measure("sql_files", [&]() {
+         my_phase_output output;
+         Render(output, [&sql](std::ostream& os) { sql.WriteSQLTables(os); });
+         Render(output, [&sql](std::ostream& os) { sql.WriteSQLAdditionals(os); });
+         Render(output, [&sql](std::ostream& os) { sql.WriteSQLRangeValues(os); });
+         Render(output, [&sql](std::ostream& os) { sql.WriteSQLDropTables(os); });
+         Render(output, [&sql](std::ostream& os) { sql.WriteSQLDocumentation(os); });
+         return output;
+         });
+
+      bench.Measure("dox", [&]() {
+         my_phase_output output;
+         Render(output, [&dict](std::ostream& os) { dict.Create_Doxygen(os); });
+         Render(output, [&dict](std::ostream& os) { dict.Create_Doxygen_SQL(os); });
+         for (auto const& [name, table] : dict.Tables()) Render(output, [&table](std::ostream& os) { table.CreateDox(os); });
+         return output;
+         });
+
+      bench.Measure("source", [&]() {
+         my_phase_output output;
+         Render(output, [&dict](std::ostream& os) { dict.CreateBaseDefintionFile(os); });
+         Render(output, [&dict](std::ostream& os) { dict.CreateBaseHeader(os); });
+         for (auto const& [name, table] : dict.Tables()) {
+            Render(output, [&table](std::ostream& os) { table.CreateHeader(os); });
+            Render(output, [&table](std::ostream& os) { table.CreateSource(os); });
+            }
+         return output;
+         });
+
+      // the same sources with both streams, a stream for every file like in Create_All
+      bench.Measure("stream_text_buffer", [&]() {
+         my_phase_output output;
+         for (auto const& [name, table] : dict.Tables()) {
+            Render<TMyTextStream>(output, [&table](std::ostream& os) { table.CreateHeader(os); });
+            Render<TMyTextStream>(output, [&table](std::ostream& os) { table.CreateSource(os); });
+            }
+         return output;
+         });
+
+      bench.Measure("stream_ostringstream", [&]() {
+         my_phase_output output;
+         for (auto const& [name, table] : dict.Tables()) {
+            Render<std::ostringstream>(output, [&table](std::ostream& os) { table.CreateHeader(os); });
+            Render<std::ostringstream>(output, [&table](std::ostream& os) { table.CreateSource(os); });
+            }
+         return output;
+         });
+
+      bench.Measure("reader", [&]() {
+         my_phase_output output;
+         Render(output, [&dict](std::ostream& os) { dict.CreateSQLStatementHeader(os); });
+         Render(output, [&dict](std::ostream& os) { dict.CreateSQLStatementSource(os); });
+         Render(output, [&dict](std::ostream& os) { dict.CreateReaderHeader(os); });
+         Render(output, [&dict](std::ostream& os) { dict.CreateReaderSource(os); });
+         return output;
+         });
+
+      bench.Measure("corba", [&]() {
+         my_phase_output output;
+         auto const strHeader = dict.Identifier() + "_Impl.h"s;
+         Render<TMyTextStream>(output, [&dict](std::ostream& os) { dict.CreateBasicCorbaIDL(os); });
+         Render<TMyTextStream>(output, [&dict](std::ostream& os) { dict.CreateCorbaIDL(os); });
+         Render(output, [&dict](std::ostream& os) { dict.CreateBasicCorbaHeader(os); });
+         Render(output, [&dict](std::ostream& os) { dict.CreateCorbaImplementationHeader(os); });
+         Render(output, [&dict, &strHeader](std::ostream& os) { dict.CreateCorbaImplementationSource(os, strHeader); });
+         return output;
+         });
+
+      fs::create_directories(config.directory);
+      auto const snapshot = config.directory / "synthetic.snapshot";
+      bench.Measure("snapshot_save", [&]() {
+         dict.SaveSnapshot(snapshot);
+         return my_phase_output { static_cast<size_t>(fs::file_size(snapshot)), 1 };
+         });
+
+      std::unique_ptr<TMyDictionary> restored;
+      bench.Measure("snapshot_load", [&]() {
+         restored = std::make_unique<TMyDictionary>();
+         if (!restored->LoadSnapshot(snapshot)) [[unlikely]] throw std::runtime_error("snapshot couldn't loaded."s);
+         return my_phase_output { static_cast<size_t>(fs::file_size(snapshot)), 1 };
+         }, [&]() { restored.reset(); });
+      restored.reset();
+
+      TMyMemoryOutput memory;
+      bench.Measure("create_all_memory", [&]() {
+         std::ostringstream out, err;
+         dict.Create_All(memory, out, err);
+         if (err.str().size() > 0) [[unlikely]] throw std::runtime_error("create_all failed: "s + err.str());
+         return my_phase_output { memory.Bytes(), memory.Size() };
+         }, [&]() { memory.Clear(); });
+
+      std::unique_ptr<TMyModelWatcher> watcher;
+      std::ostringstream watch_out, watch_err;
+      auto const strChanged = strModel + "   AddAttribute 9999 Extra Extra integer 0 0 false false \"\" \"\" \"\" \"additional attribute\"\n"s;
+      auto load = [&config](std::string const& strText) {
+         return [&config, &strText](TMyDictionary& model) {
+            LoadModelText(model, strText, "synthetic.model"s);
+            model.Threads(config.iThreads);
+            };
+         };
+      bench.Measure("watch_attribute", [&]() {
+         watcher->Apply(load(strChanged));
+         if (watch_err.str().size() > 0) [[unlikely]] throw std::runtime_error("watch failed: "s + watch_err.str());
+         return my_phase_output { memory.Bytes(), memory.Size() };
+         }, [&]() {
+            watcher = std::make_unique<TMyModelWatcher>(fs::path { }, &memory, watch_out, watch_err);
+            watcher->Apply(load(strModel));
+            memory.Clear();
+            });
+      watcher.reset();
+
+      if (config.boFiles) {
+         // the first run writes all files, the following runs compare with the existing files
+         bench.Measure("create_all", [&]() {
+            std::ostringstream out, err;
+            dict.Create_All(out, err);
+            if (err.str().size() > 0) [[unlikely]] throw std::runtime_error("create_all failed: "s + err.str());
+            return my_phase_output { };
+            });
+         }
+
+      if (config.output.empty()) WriteJSON(std::cout, config, dict, strModel.size(), bench.Results());
+      else {
+         std::ofstream ofs(config.output);
+         if (!ofs.is_open()) [[unlikely]] throw std::runtime_error("file \""s + config.output.string() + "\" couldn't opened."s);
+         WriteJSON(ofs, config, dict, strModel.size(), bench.Results());
+         }
+      return 0;
+      }
+   catch (std::exception& ex) {
+      std::cerr << ex.what() << '\n';
+      return 1;
+      }
+   }
@@ -0,0 +1,95 @@
+#pragma once
+/** \file
+   \brief dynamic bitset for sets of dense ids, used for the transitive closure of the table dependencies
+   \details the size is defined at runtime. set bits can be enumerated with a range based for loop
+            without allocation, the positions are delivered in ascending order.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for the transitive closure in the link step of TMyDictionary
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+
+class TMyBitset {
+public:
+   using word_type = uint64_t;
+   static constexpr size_t iWordBits = 64;
+
+   /// \brief forward iterator over the positions of the set bits
+   class const_iterator {
+      word_type const* words    = nullptr;   ///< words of the bitset
+      size_t           iWords   = 0;         ///< count of the words
+      size_t           iWord    = 0;         ///< index of the current word
+      word_type        current  = 0;         ///< remaining bits of the current word
+   public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = size_t;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = void;
+      using reference         = size_t;
+
+      const_iterator() = default;
+      const_iterator(word_type const* pWords, size_t pCount, size_t pWord) : words(pWords), iWords(pCount), iWord(pWord) {
+         if (iWord < iWords) current = words[iWord];
+         skip();
+         }
+
+      size_t operator * () const { return iWord * iWordBits + std::countr_zero(current); }
+      const_iterator& operator ++ () { current &= current - 1; skip(); return *this; }
+      const_iterator  operator ++ (int) { auto tmp = *this; ++*this; return tmp; }
+      bool operator == (const_iterator const& other) const { return iWord == other.iWord && current == other.current; }
+
+   private:
+      void skip() {
+         while (current == 0 && iWord < iWords) {
+            if (++iWord < iWords) current = words[iWord];
+            }
+         }
+      };
+
+private:
+   std::vector<word_type> words;   ///< bits, position n in word n / 64, bit n % 64
+   size_t                 iSize;   ///< count of bits
+
+public:
+   explicit TMyBitset(size_t pSize = 0) : words((pSize + iWordBits - 1) / iWordBits, 0), iSize(pSize) { }
+   TMyBitset(TMyBitset const&) = default;
+   TMyBitset(TMyBitset&&) noexcept = default;
+   TMyBitset& operator = (TMyBitset const&) = default;
+   TMyBitset& operator = (TMyBitset&&) noexcept = default;
+   ~TMyBitset() = default;
+
+   /** \name selectors for class TMyBitset
+       \{ */
+   size_t Size() const { return iSize; }
+   bool   Test(size_t pos) const { return pos < iSize && (words[pos / iWordBits] >> (pos % iWordBits)) & 1u; }
+   bool   Any() const { return std::ranges::any_of(words, [](word_type w) { return w != 0; }); }
+   size_t Count() const {
+      size_t iCount = 0;
+      for (auto w : words) iCount += std::popcount(w);
+      return iCount;
+      }
+   /// \}
+
+   /** \name manipulators for class TMyBitset
+       \{ */
+   void Set(size_t pos) { words[pos / iWordBits] |= word_type { 1 } << (pos % iWordBits); }
+   void Reset(size_t pos) { words[pos / iWordBits] &= ~(word_type { 1 } << (pos % iWordBits)); }
+
+   /// \brief union with a bitset of the same size
+   TMyBitset& operator |= (TMyBitset const& other) {
+      for (size_t i = 0; i < words.size() && i < other.words.size(); ++i) words[i] |= other.words[i];
+      return *this;
+      }
+   /// \}
+
+   const_iterator begin() const { return const_iterator(words.data(), words.size(), 0); }
+   const_iterator end() const { return const_iterator(words.data(), words.size(), words.size()); }
+   };
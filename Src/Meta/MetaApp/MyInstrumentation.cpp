@@ -0,0 +1,153 @@
+/** \file
+   \brief implementation of the instrumentation for TMyDictionary::Create_All
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to find the costly phases of the generator
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyInstrumentation.h"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <ranges>
+#include <stdexcept>
+
+using namespace std::string_literals;
+
+namespace {
+   using namespace std::chrono;
+
+   double milliseconds_of(TMyInstrumentation::clock::duration value) {
+      return duration_cast<duration<double, std::milli>>(value).count();
+      }
+
+   long long microseconds_of(TMyInstrumentation::clock::duration value) {
+      return duration_cast<microseconds>(value).count();
+      }
+
+   /// \brief names of jobs contain paths with backslashes, so they must be escaped for JSON
+   void write_json_text(std::ostream& out, std::string_view text) {
+      out << '"';
+      for (char ch : text) {
+         switch (ch) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n";  break;
+            case '\t': out << "\\t";  break;
+            default:
+               if (static_cast<unsigned char>(ch) < 0x20) out << std::format("\\u{:04x}", static_cast<int>(ch));
+               else out << ch;
+            }
+         }
+      out << '"';
+      }
+
+   /// \brief values of a phase for the summary
+   struct my_phase {
+      std::string                         strCategory;
+      size_t                              iJobs      = 0;
+      size_t                              iBytes     = 0;
+      TMyInstrumentation::clock::duration busy       { };
+      TMyInstrumentation::clock::duration conversion { };
+      TMyInstrumentation::clock::time_point first    = TMyInstrumentation::clock::time_point::max();
+      TMyInstrumentation::clock::time_point last     = TMyInstrumentation::clock::time_point::min();
+      };
+   }
+
+
+size_t TMyInstrumentation::Size() const {
+   std::lock_guard lock(mtx);
+   return events.size();
+   }
+
+void TMyInstrumentation::Add(my_event&& event) {
+   std::lock_guard lock(mtx);
+   event.iThread = threads.try_emplace(std::this_thread::get_id(), threads.size() + 1).first->second;
+   events.emplace_back(std::move(event));
+   }
+
+void TMyInstrumentation::WriteSummary(std::ostream& out) const {
+   std::lock_guard lock(mtx);
+   if (events.empty()) return;
+
+   // phases in the sequence of their first event, the wall time of a phase is from the first start to the last end
+   std::vector<my_phase> phases;
+   auto first = clock::time_point::max();
+   auto last  = clock::time_point::min();
+   for (auto const& event : events) {
+      auto it = std::ranges::find(phases, event.strCategory, &my_phase::strCategory);
+      if (it == phases.end()) it = phases.insert(it, my_phase { .strCategory = event.strCategory });
+      it->iJobs      += 1;
+      it->iBytes     += event.iBytes;
+      it->busy       += event.duration;
+      it->conversion += event.conversion;
+      it->first       = std::min(it->first, event.start);
+      it->last        = std::max(it->last, event.start + event.duration);
+      first           = std::min(first, event.start);
+      last            = std::max(last, event.start + event.duration);
+      }
+
+   out << std::format("\n{:<12} {:>7} {:>12} {:>11} {:>11} {:>11} {:>9}\n", "phase", "jobs", "bytes", "wall [ms]", "busy [ms]", "utf-8 [ms]", "MB/s");
+   for (auto const& phase : phases) {
+      double const busy = milliseconds_of(phase.busy);
+      out << std::format("{:<12} {:>7} {:>12} {:>11.2f} {:>11.2f} {:>11.2f} {:>9.1f}\n", phase.strCategory, phase.iJobs, phase.iBytes,
+                         milliseconds_of(phase.last - phase.first), busy, milliseconds_of(phase.conversion),
+                         busy > 0.0 ? phase.iBytes / (busy * 1'000.0) : 0.0);
+      }
+   out << std::format("total wall time: {:.2f} ms with {} threads\n", milliseconds_of(last - first), threads.size());
+
+   std::vector<my_event const*> slowest;
+   slowest.reserve(events.size());
+   for (auto const& event : events) slowest.emplace_back(&event);
+   auto const iCount = std::min<size_t>(slowest.size(), 10);
+   std::ranges::partial_sort(slowest, slowest.begin() + iCount, std::ranges::greater { }, &my_event::duration);
+   out << "slowest jobs:\n";
+   for (auto const* event : slowest | std::views::take(iCount)) {
+      out << std::format("{:>11.2f} ms  {:<8} {}\n", milliseconds_of(event->duration), event->strCategory, event->strName);
+      }
+   }
+
+void TMyInstrumentation::WriteChromeTrace(std::ostream& out) const {
+   std::lock_guard lock(mtx);
+   out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   bool boFirst = true;
+   for (auto const& event : events) {
+      out << (boFirst ? "\n" : ",\n") << "{\"name\":";
+      write_json_text(out, event.strName);
+      out << ",\"cat\":";
+      write_json_text(out, event.strCategory);
+      out << std::format(",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{},\"dur\":{},\"args\":{{\"bytes\":{},\"utf8_us\":{}}}}}",
+                         event.iThread, microseconds_of(event.start - origin), microseconds_of(event.duration),
+                         event.iBytes, microseconds_of(event.conversion));
+      boFirst = false;
+      }
+   out << "\n]}\n";
+   }
+
+void TMyInstrumentation::WriteChromeTrace(fs::path const& file) const {
+   std::ofstream out(file);
+   if (!out) [[unlikely]] throw std::runtime_error("file \""s + file.string() + "\" for the trace couldn't opened."s);
+   WriteChromeTrace(out);
+   }
+
+
+TMyScopedTimer::TMyScopedTimer(TMyInstrumentation* pTarget, std::string_view strName, std::string_view strCategory) : pInstrumentation(pTarget) {
+   if (pInstrumentation != nullptr) {
+      event.strName     = strName;
+      event.strCategory = strCategory;
+      event.start       = TMyInstrumentation::clock::now();
+      }
+   }
+
+TMyScopedTimer::~TMyScopedTimer() {
+   if (pInstrumentation != nullptr) {
+      event.duration = TMyInstrumentation::clock::now() - event.start;
+      try {
+         pInstrumentation->Add(std::move(event));
+         }
+      catch (...) { }   // a lost event doesn't matter for the generator
+      }
+   }
@@ -0,0 +1,79 @@
+#pragma once
+/** \file
+   \brief instrumentation for the phases and jobs of TMyDictionary::Create_All
+   \details every job of Create_All can be measured with a TMyScopedTimer. the timer notes the wall time,
+            the count of bytes and the time for the conversion to UTF-8 and adds an event to the
+            instrumentation when it leaves the scope. without instrumentation (nullptr) the timer does nothing.
+            the events are written as summary table for the phases (sql, dox, source, reader, corba, write)
+            or as trace in the JSON format of chrome://tracing / Perfetto, with one row for every worker thread.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to find the costly phases of the generator
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <ostream>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+class TMyInstrumentation {
+public:
+   using clock = std::chrono::steady_clock;
+
+   /// \brief measured job or phase
+   struct my_event {
+      std::string        strName;               ///< name of the job, for files the file name
+      std::string        strCategory;           ///< phase of the job (sql, dox, source, reader, corba, write, ...)
+      clock::time_point  start;                 ///< start of the job
+      clock::duration    duration   { };        ///< wall time of the job
+      clock::duration    conversion { };        ///< part of duration used for the conversion to UTF-8
+      size_t             iBytes     = 0;        ///< count of produced bytes
+      size_t             iThread    = 0;        ///< number of the thread, in the sequence of the first event
+      };
+
+private:
+   mutable std::mutex               mtx;                      ///< Add is called by the worker threads
+   clock::time_point const          origin = clock::now();    ///< start of the instrumentation, zero point of the trace
+   std::vector<my_event>            events;                   ///< all events in the sequence of their end
+   std::map<std::thread::id, size_t> threads;                 ///< short numbers for the threads
+
+public:
+   TMyInstrumentation() = default;
+   TMyInstrumentation(TMyInstrumentation const&) = delete;
+   ~TMyInstrumentation() = default;
+
+   /// \brief count of the events
+   size_t Size() const;
+
+   /// \brief add an event, the thread of the caller is noted for the event
+   void Add(my_event&& event);
+
+   /// \brief write a table with one row for every phase and the slowest jobs
+   void WriteSummary(std::ostream& out) const;
+
+   /// \brief write the events as trace in the format of chrome://tracing
+   void WriteChromeTrace(std::ostream& out) const;
+   void WriteChromeTrace(fs::path const& file) const;
+   };
+
+/// \brief measure a scope and add it to the instrumentation, doesn't measure without instrumentation
+class TMyScopedTimer {
+   TMyInstrumentation*           pInstrumentation;   ///< target of the event, nullptr = no measurement
+   TMyInstrumentation::my_event  event;              ///< event in preparation
+public:
+   TMyScopedTimer(TMyInstrumentation* pTarget, std::string_view strName, std::string_view strCategory);
+   TMyScopedTimer(TMyScopedTimer const&) = delete;
+   ~TMyScopedTimer();
+
+   void Bytes(size_t iBytes) { event.iBytes = iBytes; }
+   void Conversion(TMyInstrumentation::clock::duration conversion) { event.conversion = conversion; }
+   };
@@ -0,0 +1,142 @@
+/** \file
+   \brief implementation of the work-stealing scheduler for the metadata generator
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for the parallel generation in TMyDictionary::Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyJobScheduler.h"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+unsigned int TMyJobScheduler::Threads() const {
+   if (iThreads > 0) return iThreads;
+   else return std::max(1u, std::thread::hardware_concurrency());
+   }
+
+TMyJobScheduler::job_id TMyJobScheduler::Add(std::string const& pName, job_func&& pFunc, std::vector<job_id> const& pDepends) {
+   job_id id = jobs.size();
+   for (auto const& dep : pDepends) {
+      if (dep >= id) [[unlikely]]
+         throw std::runtime_error(std::format("job \"{}\" depends on an unknown job with id {}.", pName, dep));
+      }
+
+   jobs.emplace_back(job_data { pName, std::move(pFunc), { }, pDepends.size(), nullptr });
+   for (auto const& dep : pDepends) jobs[dep].successors.emplace_back(id);
+   return id;
+   }
+
+void TMyJobScheduler::Run() {
+   if (jobs.empty()) return;
+
+   /// queue of a worker thread, the owner works LIFO on the back, thieves take from the front
+   struct worker_queue {
+      std::mutex         mtx;
+      std::deque<job_id> ready;
+      };
+
+   size_t const iWorkers = std::min<size_t>(Threads(), jobs.size());
+   std::vector<worker_queue> queues(iWorkers);
+   std::vector<std::atomic<size_t>> open_predecessors(jobs.size());
+   std::atomic<size_t> remaining { jobs.size() };
+   std::atomic<size_t> queued { 0 };
+   std::mutex mtxWait, mtxError;
+   std::condition_variable cvWait;
+
+   auto push = [&](job_id id, size_t worker) {
+      {
+         std::lock_guard lock(queues[worker].mtx);
+         queues[worker].ready.push_back(id);
+      }
+      queued.fetch_add(1);
+      { std::lock_guard lock(mtxWait); }
+      cvWait.notify_one();
+      };
+
+   auto pop = [&](size_t worker) -> std::optional<job_id> {
+      {  // own jobs first, newest first to stay in the cache
+         std::lock_guard lock(queues[worker].mtx);
+         if (!queues[worker].ready.empty()) {
+            job_id id = queues[worker].ready.back();
+            queues[worker].ready.pop_back();
+            queued.fetch_sub(1);
+            return id;
+            }
+      }
+      for (size_t step = 1; step < iWorkers; ++step) { // steal the oldest job of another worker
+         auto& victim = queues[(worker + step) % iWorkers];
+         std::lock_guard lock(victim.mtx);
+         if (!victim.ready.empty()) {
+            job_id id = victim.ready.front();
+            victim.ready.pop_front();
+            queued.fetch_sub(1);
+            return id;
+            }
+         }
+      return { };
+      };
+
+   auto execute = [&](job_id id, size_t worker) {
+      auto& job = jobs[id];
+      if (!job.error) [[likely]] {
+         try {
+            job.func();
+            }
+         catch (...) {
+            job.error = std::current_exception();
+            }
+         }
+
+      for (auto const& succ : job.successors) {
+         if (job.error) [[unlikely]] {
+            std::lock_guard lock(mtxError);
+            if (!jobs[succ].error) jobs[succ].error = job.error;
+            }
+         if (open_predecessors[succ].fetch_sub(1) == 1) push(succ, worker);
+         }
+
+      if (remaining.fetch_sub(1) == 1) {
+         std::lock_guard lock(mtxWait);
+         cvWait.notify_all();
+         }
+      };
+
+   auto worker_loop = [&](size_t worker) {
+      while (remaining.load() > 0) {
+         if (auto id = pop(worker); id) [[likely]] execute(*id, worker);
+         else {
+            std::unique_lock lock(mtxWait);
+            cvWait.wait(lock, [&]() { return queued.load() > 0 || remaining.load() == 0; });
+            }
+         }
+      };
+
+   // distribute the jobs without predecessors round robin over the workers
+   for (size_t worker = 0, id = 0; auto& job : jobs) {
+      open_predecessors[id].store(job.iPredecessors);
+      if (job.iPredecessors == 0) {
+         queues[worker].ready.push_back(id);
+         queued.fetch_add(1);
+         worker = (worker + 1) % iWorkers;
+         }
+      ++id;
+      }
+
+   if (iWorkers == 1) worker_loop(0);
+   else {
+      std::vector<std::jthread> threads;
+      threads.reserve(iWorkers - 1);
+      for (size_t worker = 1; worker < iWorkers; ++worker) threads.emplace_back(worker_loop, worker);
+      worker_loop(0);
+      }
+   }
@@ -0,0 +1,59 @@
+#pragma once
+/** \file
+   \brief work-stealing scheduler for the jobs of the metadata generator
+   \details the scheduler holds a graph of jobs. every job can name jobs which must be finished
+            before it may start. jobs without open predecessors are distributed over the queues
+            of the worker threads, an idle worker steals jobs from the queues of the other workers.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for the parallel generation in TMyDictionary::Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <exception>
+
+class TMyJobScheduler {
+public:
+   using job_id   = size_t;                     ///< index of a job inside of the scheduler
+   using job_func = std::function<void()>;      ///< function which executed for a job
+
+private:
+   /// \brief internal data for a job in the graph
+   struct job_data {
+      std::string         strName;              ///< name of the job, used for messages
+      job_func            func;                 ///< function to execute
+      std::vector<job_id> successors;           ///< jobs which wait for this job
+      size_t              iPredecessors = 0;    ///< count of jobs which must finished before this job
+      std::exception_ptr  error;                ///< exception of this job or of a failed predecessor
+      };
+
+   std::vector<job_data> jobs;                  ///< all jobs of this graph, the sequence is the order of Add
+   unsigned int          iThreads;              ///< count of worker threads, 0 = hardware concurrency
+
+public:
+   explicit TMyJobScheduler(unsigned int pThreads = 0) : iThreads(pThreads) { }
+   TMyJobScheduler(TMyJobScheduler const&) = delete;
+   TMyJobScheduler(TMyJobScheduler&&) noexcept = delete;
+   ~TMyJobScheduler() = default;
+
+   /** \name selectors for class TMyJobScheduler
+       \{ */
+   size_t             Size() const { return jobs.size(); }
+   unsigned int       Threads() const;
+   std::string const& Name(job_id id) const { return jobs.at(id).strName; }
+   bool               Failed(job_id id) const { return jobs.at(id).error != nullptr; }
+   std::exception_ptr Error(job_id id) const { return jobs.at(id).error; }
+   /// \}
+
+   /// \brief add a job to the graph, the job starts when all jobs in pDepends are finished
+   job_id Add(std::string const& pName, job_func&& pFunc, std::vector<job_id> const& pDepends = { });
+
+   /// \brief execute all jobs and wait until all jobs are finished
+   /// \details exceptions are catched and stored for the job, successors of a failed job are not executed
+   ///          and get the exception of the predecessor. use Failed() and Error() to check the results.
+   void Run();
+   };
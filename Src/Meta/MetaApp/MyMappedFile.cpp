@@ -0,0 +1,88 @@
+/** \file
+   \brief implementation of the read only memory mapped file for windows and posix systems
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for the loader of model files
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyMappedFile.h"
+
+#include <string>
+#include <stdexcept>
+
+#if defined(_WIN32)
+   #define WIN32_LEAN_AND_MEAN
+   #define NOMINMAX
+   #include <windows.h>
+#else
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <fcntl.h>
+   #include <unistd.h>
+#endif
+
+using namespace std::string_literals;
+
+#if defined(_WIN32)
+
+TMyMappedFile::TMyMappedFile(fs::path const& pPath) : path(pPath) {
+   hFile = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+   if (hFile == INVALID_HANDLE_VALUE) [[unlikely]] {
+      hFile = nullptr;
+      throw std::runtime_error("file \""s + path.string() + "\" couldn't opened."s);
+      }
+
+   LARGE_INTEGER size;
+   if (!::GetFileSizeEx(hFile, &size)) [[unlikely]] {
+      ::CloseHandle(hFile);
+      throw std::runtime_error("size of file \""s + path.string() + "\" couldn't determined."s);
+      }
+   iSize = static_cast<size_t>(size.QuadPart);
+   if (iSize == 0) return;   // an empty file can't be mapped
+
+   hMapping = ::CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   if (hMapping != nullptr) pData = static_cast<char const*>(::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+   if (pData == nullptr) [[unlikely]] {
+      if (hMapping != nullptr) ::CloseHandle(hMapping);
+      ::CloseHandle(hFile);
+      throw std::runtime_error("file \""s + path.string() + "\" couldn't mapped."s);
+      }
+   }
+
+TMyMappedFile::~TMyMappedFile() {
+   if (pData != nullptr) ::UnmapViewOfFile(pData);
+   if (hMapping != nullptr) ::CloseHandle(hMapping);
+   if (hFile != nullptr) ::CloseHandle(hFile);
+   }
+
+#else
+
+TMyMappedFile::TMyMappedFile(fs::path const& pPath) : path(pPath) {
+   int const fd = ::open(path.c_str(), O_RDONLY);
+   if (fd < 0) [[unlikely]] throw std::runtime_error("file \""s + path.string() + "\" couldn't opened."s);
+
+   struct stat info;
+   if (::fstat(fd, &info) != 0) [[unlikely]] {
+      ::close(fd);
+      throw std::runtime_error("size of file \""s + path.string() + "\" couldn't determined."s);
+      }
+   iSize = static_cast<size_t>(info.st_size);
+   if (iSize > 0) {
+      void* mapping = ::mmap(nullptr, iSize, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping == MAP_FAILED) [[unlikely]] {
+         ::close(fd);
+         throw std::runtime_error("file \""s + path.string() + "\" couldn't mapped."s);
+         }
+      ::madvise(mapping, iSize, MADV_SEQUENTIAL);
+      pData = static_cast<char const*>(mapping);
+      }
+   ::close(fd);   // the mapping stays valid without the descriptor
+   }
+
+TMyMappedFile::~TMyMappedFile() {
+   if (pData != nullptr) ::munmap(const_cast<char*>(pData), iSize);
+   }
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+/** \file
+   \brief read only memory mapped file
+   \details the content of the file is mapped into the address space of the process and available as
+            std::string_view without a copy. the view is valid for the lifetime of the object.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for the loader of model files
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string_view>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+class TMyMappedFile {
+private:
+   char const* pData = nullptr;   ///< begin of the mapped content, nullptr for an empty file
+   size_t      iSize = 0;         ///< size of the file in bytes
+#if defined(_WIN32)
+   void*       hFile    = nullptr; ///< handle of the opened file
+   void*       hMapping = nullptr; ///< handle of the file mapping object
+#endif
+   fs::path    path;              ///< name of the file for messages
+
+public:
+   TMyMappedFile() = delete;
+   explicit TMyMappedFile(fs::path const& pPath);
+   TMyMappedFile(TMyMappedFile const&) = delete;
+   TMyMappedFile& operator = (TMyMappedFile const&) = delete;
+   ~TMyMappedFile();
+
+   /** \name selectors for class TMyMappedFile
+       \{ */
+   std::string_view Text() const { return { pData, iSize }; }
+   size_t           Size() const { return iSize; }
+   fs::path const&  Path() const { return path; }
+   /// \}
+   };
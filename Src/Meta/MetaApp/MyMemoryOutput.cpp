@@ -0,0 +1,161 @@
+/** \file
+   \brief implementation of the output backend which holds the generated files in memory
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to exchange the target of Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyMemoryOutput.h"
+
+#include <array>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+using namespace std::string_literals;
+
+namespace {
+   constexpr size_t iTarBlock = 512;   ///< size of a block in a tar archive
+
+   /// \brief header of a file in a tar archive with the ustar extension
+   struct my_tar_header {
+      char name[100];
+      char mode[8];
+      char uid[8];
+      char gid[8];
+      char size[12];
+      char mtime[12];
+      char chksum[8];
+      char typeflag;
+      char linkname[100];
+      char magic[6];
+      char version[2];
+      char uname[32];
+      char gname[32];
+      char devmajor[8];
+      char devminor[8];
+      char prefix[155];
+      char pad[12];
+      };
+   static_assert(sizeof(my_tar_header) == iTarBlock);
+
+   /// \brief octal number with leading zeros, terminated with '\0', like all numeric fields of tar
+   template <size_t N>
+   void put_octal(char (&field)[N], uint64_t value) {
+      auto const text = std::format("{:0{}o}", value, N - 1);
+      if (text.size() > N - 1) [[unlikely]] throw std::runtime_error("value "s + std::to_string(value) + " too large for the tar archive."s);
+      std::ranges::copy(text, field);
+      }
+
+   /// \brief name of the file in the archive, the name is split into prefix and name when it is longer than 100 characters
+   void put_name(my_tar_header& header, std::string_view strName) {
+      if (strName.size() <= sizeof(header.name)) {
+         std::ranges::copy(strName, header.name);
+         return;
+         }
+      for (auto pos = strName.find('/'); pos != std::string_view::npos; pos = strName.find('/', pos + 1)) {
+         if (pos <= sizeof(header.prefix) && strName.size() - pos - 1 <= sizeof(header.name)) {
+            std::ranges::copy(strName.substr(0, pos), header.prefix);
+            std::ranges::copy(strName.substr(pos + 1), header.name);
+            return;
+            }
+         }
+      throw std::runtime_error("path \""s + std::string(strName) + "\" too long for the tar archive."s);
+      }
+   }
+
+
+size_t TMyMemoryOutput::Size() const {
+   std::lock_guard lock(mtxFiles);
+   return files.size();
+   }
+
+size_t TMyMemoryOutput::Bytes() const {
+   std::lock_guard lock(mtxFiles);
+   return std::accumulate(files.begin(), files.end(), size_t { 0 }, [](size_t sum, auto const& file) { return sum + file.second.size(); });
+   }
+
+std::optional<std::string_view> TMyMemoryOutput::Find(fs::path const& file) const {
+   std::lock_guard lock(mtxFiles);
+   if (auto it = files.find(file.generic_string()); it != files.end()) return it->second;
+   else return { };
+   }
+
+void TMyMemoryOutput::CreateDirectories(fs::path const& path) {
+   std::lock_guard lock(mtxFiles);
+   directories.emplace(path.generic_string());
+   }
+
+bool TMyMemoryOutput::Write(fs::path const& file, TMyTextBuffer const& content) {
+   auto const hash = TMyOutputWriter::Hash(content);   // built outside of the lock
+   auto strFile = file.generic_string();
+   {
+      std::lock_guard lock(mtxFiles);
+      if (auto it = hashes.find(strFile); it != hashes.end() && it->second == hash) {
+         ++iUnchanged;
+         return false;
+         }
+   }
+   auto strContent = content.Str();   // copied outside of the lock
+   std::lock_guard lock(mtxFiles);
+   hashes.insert_or_assign(strFile, hash);
+   files.insert_or_assign(std::move(strFile), std::move(strContent));
+   ++iWritten;
+   return true;
+   }
+
+void TMyMemoryOutput::Clear() {
+   std::lock_guard lock(mtxFiles);
+   files.clear();
+   hashes.clear();
+   directories.clear();
+   iWritten   = 0;
+   iUnchanged = 0;
+   }
+
+void TMyMemoryOutput::WriteTar(std::ostream& out) const {
+   static constexpr std::array<char, iTarBlock> padding { };
+   auto const mtime = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+   auto write_header = [&out, mtime](std::string const& strPath, size_t iSize, char cType) {
+      my_tar_header header { };
+      put_name(header, strPath);
+      put_octal(header.mode, cType == '5' ? 0755 : 0644);
+      put_octal(header.uid, 0);
+      put_octal(header.gid, 0);
+      put_octal(header.size, iSize);
+      put_octal(header.mtime, static_cast<uint64_t>(mtime));
+      header.typeflag = cType;
+      std::ranges::copy(std::string_view("ustar"), header.magic);
+      std::ranges::copy(std::string_view("00"), header.version);
+
+      // the checksum is calculated with spaces in the field of the checksum
+      std::ranges::fill(header.chksum, ' ');
+      auto const* bytes = reinterpret_cast<unsigned char const*>(&header);
+      put_octal(header.chksum, std::accumulate(bytes, bytes + sizeof(header), uint64_t { 0 }));
+      out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+      };
+
+   std::lock_guard lock(mtxFiles);
+   // directories are written too, so empty directories are part of the archive
+   for (auto const& strDirectory : directories) {
+      if (auto strPath = fs::path(strDirectory).relative_path().generic_string(); !strPath.empty()) {
+         write_header(strPath.back() == '/' ? strPath : strPath + "/"s, 0, '5');
+         }
+      }
+
+   for (auto const& [strFile, strContent] : files) {
+      write_header(fs::path(strFile).relative_path().generic_string(), strContent.size(), '0');
+      out.write(strContent.data(), strContent.size());
+      if (auto const rest = strContent.size() % iTarBlock; rest > 0) out.write(padding.data(), iTarBlock - rest);
+      }
+
+   // the end of the archive are two empty blocks
+   out.write(padding.data(), padding.size());
+   out.write(padding.data(), padding.size());
+   if (!out) [[unlikely]] throw std::runtime_error("error when writing the tar archive."s);
+   }
@@ -0,0 +1,64 @@
+#pragma once
+/** \file
+   \brief output backend which holds the generated files in memory
+   \details the files are stored with their generic path as key, so the tree can be read after Create_All
+            without a filesystem. a second run with the same backend counts files with the same content as
+            unchanged, the content is compared with TMyOutputWriter::Hash without the time stamps of the generator,
+            an unchanged file keeps the content of the first run. WriteTar writes the complete tree as one archive in ustar format with one sequential write.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to exchange the target of Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <string_view>
+#include <map>
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <optional>
+#include <ostream>
+
+#include "MyOutputBackend.h"
+#include "MyOutputWriter.h"
+
+class TMyMemoryOutput : public TMyOutputBackend {
+   std::map<std::string, std::string>  files;                ///< content of the files, key is the generic path
+   std::map<std::string, TMyOutputWriter::hash_type> hashes; ///< hash of the content without time stamps, key is the generic path
+   std::set<std::string>               directories;          ///< created directories, key is the generic path
+   mutable std::mutex                  mtxFiles;             ///< lock for files and directories, files are written parallel
+   std::atomic<size_t>                 iWritten   = 0;       ///< count of written files
+   std::atomic<size_t>                 iUnchanged = 0;       ///< count of files with the same content as before
+
+public:
+   TMyMemoryOutput() = default;
+   TMyMemoryOutput(TMyMemoryOutput const&) = delete;
+   ~TMyMemoryOutput() override = default;
+
+   /** \name selectors for class TMyMemoryOutput
+       \{ */
+   size_t Written() const override { return iWritten.load(); }
+   size_t Unchanged() const override { return iUnchanged.load(); }
+   /// \brief count of files in the memory
+   size_t Size() const;
+   /// \brief sum of the sizes of all files
+   size_t Bytes() const;
+   /// \brief content of the file, no value when the file wasn't written
+   /// \details the view is valid until the file is written again or the backend is cleared
+   std::optional<std::string_view> Find(fs::path const& file) const;
+   /// \brief all files with their content, use it only when no Create_All is running
+   std::map<std::string, std::string> const& Files() const { return files; }
+   /// \}
+
+   void CreateDirectories(fs::path const& path) override;
+   bool Write(fs::path const& file, TMyTextBuffer const& content) override;
+   void Save() const override { }
+
+   /// \brief remove all files and reset the counters
+   void Clear();
+
+   /// \brief write all files as tar archive (ustar), the root of absolute paths is removed
+   void WriteTar(std::ostream& out) const;
+   };
@@ -0,0 +1,327 @@
+/** \file
+   \brief implementation of the loader for declarative model files
+   \details the lines are split into views of the memory mapped file, the statements are dispatched with a
+            table of the keywords to the manipulators of TMyDictionary and TMyTable.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to load models without a new build of the generator
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyModelLoader.h"
+#include "MyMappedFile.h"
+
+#include <vector>
+#include <deque>
+#include <array>
+#include <optional>
+#include <utility>
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace {
+
+   /// \brief error in the model file, the message contains the position already
+   class my_model_error : public std::runtime_error {
+   public:
+      using std::runtime_error::runtime_error;
+      };
+
+   constexpr auto entity_types = std::to_array<std::pair<std::string_view, EMyEntityType>>({
+      { "undefined"sv, EMyEntityType::undefined }, { "table"sv, EMyEntityType::table }, { "range"sv, EMyEntityType::range },
+      { "relationship"sv, EMyEntityType::relationship }, { "view"sv, EMyEntityType::view } });
+
+   constexpr auto reference_types = std::to_array<std::pair<std::string_view, EMyReferenceType>>({
+      { "undefined"sv, EMyReferenceType::undefined }, { "generalization"sv, EMyReferenceType::generalization },
+      { "range"sv, EMyReferenceType::range }, { "assoziation"sv, EMyReferenceType::assoziation },
+      { "aggregation"sv, EMyReferenceType::aggregation }, { "composition"sv, EMyReferenceType::composition } });
+
+   constexpr auto index_types = std::to_array<std::pair<std::string_view, EMyIndexType>>({
+      { "undefined"sv, EMyIndexType::undefined }, { "key"sv, EMyIndexType::key }, { "unique"sv, EMyIndexType::unique },
+      { "clustered"sv, EMyIndexType::clustered }, { "nonclustered"sv, EMyIndexType::nonclustered } });
+
+   constexpr auto record_layouts = std::to_array<std::pair<std::string_view, EMyRecordLayout>>({
+      { "optional"sv, EMyRecordLayout::optional }, { "null_bitmap"sv, EMyRecordLayout::null_bitmap } });
+
+   constexpr auto container_types = std::to_array<std::pair<std::string_view, EMyContainerType>>({
+      { "map"sv, EMyContainerType::map }, { "flat_map"sv, EMyContainerType::flat_map } });
+
+   bool parse_value(std::string_view text, bool& value) {
+      if (text == "true"sv) value = true;
+      else if (text == "false"sv) value = false;
+      else return false;
+      return true;
+      }
+
+   template <std::integral ty>
+   bool parse_value(std::string_view text, ty& value) {
+      auto const [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+      return ec == std::errc { } && ptr == text.data() + text.size();
+      }
+
+   bool is_space(char ch) { return ch == ' ' || ch == '\t'; }
+
+   /// \brief FNV-1a hash of the model file, source hash for the snapshot
+   uint64_t model_hash(std::string_view text) {
+      uint64_t hash = 0xcbf29ce484222325ull;
+      for (unsigned char ch : text) hash = (hash ^ ch) * 0x100000001b3ull;
+      return hash;
+      }
+
+
+   /// \brief one line of the model file, split into the keyword and the arguments
+   class my_statement {
+      std::vector<std::string_view> tokens;     ///< keyword and arguments, views into the line or into unescaped
+      std::deque<std::string>       unescaped;  ///< storage for arguments with escape sequences, deque keeps the addresses
+      std::string const&            strFile;    ///< name of the file for messages
+      size_t                        iLine = 0;  ///< number of the line, starting with 1
+   public:
+      explicit my_statement(std::string const& pFile) : strFile(pFile) { }
+
+      /// \brief split the line, false for empty lines and comments
+      bool Parse(std::string_view line, size_t pLine);
+
+      std::string_view Keyword() const { return tokens.front(); }
+      size_t           Count() const { return tokens.size() - 1; }  ///< count of arguments
+      std::string_view Argument(size_t i) const { return tokens[i + 1]; }
+
+      [[noreturn]] void Error(std::string const& strMessage) const {
+         throw my_model_error(strFile + "("s + std::to_string(iLine) + "): "s + strMessage);
+         }
+
+      std::string Text(size_t i) const { return std::string(Argument(i)); }
+
+      template <typename ty>
+      ty Value(size_t i) const {
+         ty value { };
+         if (!parse_value(Argument(i), value)) [[unlikely]] WrongArgument(i);
+         return value;
+         }
+
+      std::optional<size_t> OptionalValue(size_t i) const {
+         if (Argument(i) == "-"sv) return { };
+         else return Value<size_t>(i);
+         }
+
+      template <typename enum_ty, size_t count>
+      enum_ty Enum(size_t i, std::array<std::pair<std::string_view, enum_ty>, count> const& names) const {
+         auto it = std::ranges::find(names, Argument(i), &std::pair<std::string_view, enum_ty>::first);
+         if (it == names.end()) [[unlikely]] WrongArgument(i);
+         return it->second;
+         }
+
+      /// \brief arguments from position start as pairs first:second
+      template <typename first_ty, typename second_ty>
+      std::vector<std::pair<first_ty, second_ty>> Pairs(size_t start) const {
+         std::vector<std::pair<first_ty, second_ty>> values;
+         values.reserve(Count() - start);
+         for (size_t i = start; i < Count(); ++i) {
+            auto const text = Argument(i);
+            auto const pos = text.find(':');
+            std::pair<first_ty, second_ty> value;
+            if (pos == std::string_view::npos || !parse_value(text.substr(0, pos), value.first) ||
+                !parse_value(text.substr(pos + 1), value.second)) [[unlikely]] WrongArgument(i);
+            values.emplace_back(value);
+            }
+         return values;
+         }
+
+   private:
+      [[noreturn]] void WrongArgument(size_t i) const {
+         Error("argument "s + std::to_string(i + 1) + " of "s + std::string(Keyword()) + " with invalid value \""s + Text(i) + "\"."s);
+         }
+
+      std::string_view Unescape(std::string_view text);
+      };
+
+   bool my_statement::Parse(std::string_view line, size_t pLine) {
+      iLine = pLine;
+      tokens.clear();
+      unescaped.clear();
+      for (size_t pos = 0; ; ) {
+         while (pos < line.size() && is_space(line[pos])) ++pos;
+         if (pos == line.size() || (tokens.empty() && line[pos] == '#')) break;
+         if (line[pos] == '"') {
+            size_t const start = ++pos;
+            bool boEscaped = false;
+            for (; pos < line.size() && line[pos] != '"'; ++pos) {
+               if (line[pos] == '\\') { boEscaped = true; ++pos; }
+               }
+            if (pos >= line.size()) [[unlikely]] Error("missing closing quotation mark."s);
+            auto const text = line.substr(start, pos - start);
+            tokens.emplace_back(boEscaped ? Unescape(text) : text);
+            if (++pos < line.size() && !is_space(line[pos])) [[unlikely]] Error("missing space after closing quotation mark."s);
+            }
+         else {
+            size_t const start = pos;
+            while (pos < line.size() && !is_space(line[pos])) ++pos;
+            tokens.emplace_back(line.substr(start, pos - start));
+            }
+         }
+      return !tokens.empty();
+      }
+
+   std::string_view my_statement::Unescape(std::string_view text) {
+      auto& target = unescaped.emplace_back();
+      target.reserve(text.size());
+      for (size_t pos = 0; pos < text.size(); ++pos) {
+         if (text[pos] != '\\') target.push_back(text[pos]);
+         else {
+            switch (text[++pos]) {
+               case 'n':  target.push_back('\n'); break;
+               case 't':  target.push_back('\t'); break;
+               case '"':  target.push_back('"'); break;
+               case '\\': target.push_back('\\'); break;
+               default: [[unlikely]] Error("unknown escape sequence \"\\"s + text[pos] + "\"."s);
+               }
+            }
+         }
+      return target;
+      }
+
+
+   /// \brief state while loading, the statements for tables refer to the table of the last AddTable
+   struct my_context {
+      TMyDictionary& dictionary;
+      TMyTable*      table = nullptr;
+
+      TMyTable& Table(my_statement const& stmt) const {
+         if (table == nullptr) [[unlikely]] stmt.Error(std::string(stmt.Keyword()) + " without a preceding AddTable."s);
+         return *table;
+         }
+      };
+
+   using my_handler = void (*)(my_context&, my_statement const&);
+
+   struct my_keyword {
+      std::string_view keyword;
+      size_t           iMinArgs;
+      size_t           iMaxArgs;
+      my_handler       handler;
+      };
+
+   constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+   /// keywords with the count of arguments, the most frequent statements first
+   constexpr auto keywords = std::to_array<my_keyword>({
+      { "AddAttribute"sv, 12, 12, [](my_context& ctx, my_statement const& stmt) {
+           ctx.Table(stmt).AddAttribute(stmt.Value<int>(0), stmt.Text(1), stmt.Text(2), stmt.Text(3), stmt.Value<size_t>(4), stmt.Value<size_t>(5),
+                                        stmt.Value<bool>(6), stmt.Value<bool>(7), stmt.Text(8), stmt.Text(9), stmt.Text(10), stmt.Text(11));
+           } },
+      { "AddReference"sv, 7, unlimited, [](my_context& ctx, my_statement const& stmt) {
+           ctx.Table(stmt).AddReference(stmt.Text(0), stmt.Enum(1, reference_types), stmt.Text(2), stmt.Text(3), stmt.Text(4),
+                                        stmt.OptionalValue(5), stmt.Text(6), stmt.Pairs<size_t, size_t>(7));
+           } },
+      { "AddIndex"sv, 3, unlimited, [](my_context& ctx, my_statement const& stmt) {
+           ctx.Table(stmt).AddIndex(stmt.Text(0), stmt.Enum(1, index_types), stmt.Text(2), stmt.Pairs<size_t, bool>(3));
+           } },
+      { "AddTable"sv, 9, 9, [](my_context& ctx, my_statement const& stmt) {
+           ctx.table = &ctx.dictionary.AddTable(stmt.Text(0), stmt.Enum(1, entity_types), stmt.Text(2), stmt.Text(3), stmt.Text(4),
+                                                stmt.Text(5), stmt.Text(6), stmt.Text(7), stmt.Text(8));
+           } },
+      { "AddRangeValue"sv,     1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.Table(stmt).AddRangeValue(stmt.Text(0)); } },
+      { "AddPostConditions"sv, 1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.Table(stmt).AddPostConditions(stmt.Text(0)); } },
+      { "AddCleanings"sv,      1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.Table(stmt).AddCleanings(stmt.Text(0)); } },
+      { "AddDescription"sv,    1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.Table(stmt).AddDescription(stmt.Text(0)); } },
+      { "AddComment"sv,        1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.Table(stmt).AddComment(stmt.Text(0)); } },
+      { "OwnContainerType"sv,  1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.Table(stmt).OwnContainerType(stmt.Enum(0, container_types)); } },
+      { "AddDataType"sv, 13, 13, [](my_context& ctx, my_statement const& stmt) {
+           ctx.dictionary.AddDataType(stmt.Text(0), stmt.Text(1), stmt.Value<bool>(2), stmt.Value<bool>(3), stmt.Value<bool>(4), stmt.Text(5),
+                                      stmt.Text(6), stmt.Text(7), stmt.Text(8), stmt.Text(9), stmt.Text(10), stmt.Value<bool>(11), stmt.Text(12));
+           } },
+      { "AddNameSpace"sv, 3, 5, [](my_context& ctx, my_statement const& stmt) {
+           ctx.dictionary.AddNameSpace(stmt.Text(0), stmt.Text(1), stmt.Text(2), stmt.Count() > 3 ? stmt.Text(3) : ""s,
+                                       stmt.Count() > 4 ? stmt.Text(4) : ""s);
+           } },
+      { "AddDirectory"sv, 3, 3, [](my_context& ctx, my_statement const& stmt) {
+           ctx.dictionary.AddDirectory(stmt.Text(0), stmt.Text(1), stmt.Text(2));
+           } },
+      { "Name"sv,                  1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Name(stmt.Text(0)); } },
+      { "Version"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Version(stmt.Text(0)); } },
+      { "Denotation"sv,            1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Denotation(stmt.Text(0)); } },
+      { "Description"sv,           1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Description(stmt.Text(0)); } },
+      { "Comment"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Comment(stmt.Text(0)); } },
+      { "Author"sv,                1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Author(stmt.Text(0)); } },
+      { "Copyright"sv,             1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Copyright(stmt.Text(0)); } },
+      { "License"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.License(stmt.Text(0)); } },
+      { "ReaderClass"sv,           1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.ReaderClass(stmt.Text(0)); } },
+      { "ReaderFile"sv,            1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.ReaderFile(stmt.Text(0)); } },
+      { "SourcePath"sv,            1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.SourcePath(stmt.Text(0)); } },
+      { "SQLPath"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.SQLPath(stmt.Text(0)); } },
+      { "DocPath"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.DocPath(stmt.Text(0)); } },
+      { "IDLPath"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.IDLPath(stmt.Text(0)); } },
+      { "CorbaPath"sv,             1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.CorbaPath(stmt.Text(0)); } },
+      { "ManifestFile"sv,          1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.ManifestFile(stmt.Text(0)); } },
+      { "BaseClass"sv,             1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.BaseClass(stmt.Text(0)); } },
+      { "BaseNamespace"sv,         1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.BaseNamespace(stmt.Text(0)); } },
+      { "PathToBase"sv,            1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PathToBase(stmt.Text(0)); } },
+      { "PersistenceClass"sv,      1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PersistenceClass(stmt.Text(0)); } },
+      { "PersistenceName"sv,       1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PersistenceName(stmt.Text(0)); } },
+      { "PersistenceNamespace"sv,  1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PersistenceNamespace(stmt.Text(0)); } },
+      { "PathToPersistence"sv,     1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PathToPersistence(stmt.Text(0)); } },
+      { "PersistenceServerType"sv, 1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PersistenceServerType(stmt.Text(0)); } },
+      { "PersistenceDatabase"sv,   1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.PersistenceDatabase(stmt.Text(0)); } },
+      { "Threads"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Threads(stmt.Value<unsigned int>(0)); } },
+      { "Timings"sv,               1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.Timings(stmt.Value<bool>(0)); } },
+      { "TraceFile"sv,             1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.TraceFile(stmt.Text(0)); } },
+      { "RecordLayout"sv,          1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.RecordLayout(stmt.Enum(0, record_layouts)); } },
+      { "ColumnContainer"sv,       1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.ColumnContainer(stmt.Value<bool>(0)); } },
+      { "ContainerType"sv,         1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.ContainerType(stmt.Enum(0, container_types)); } },
+      { "HashContainer"sv,         1, 1, [](my_context& ctx, my_statement const& stmt) { ctx.dictionary.HashContainer(stmt.Value<bool>(0)); } }
+      });
+   }
+
+
+void LoadModelFile(TMyDictionary& dictionary, fs::path const& file) {
+   TMyMappedFile mapping(file);
+   LoadModelText(dictionary, mapping.Text(), file.string());
+   }
+
+void LoadModelFile(TMyDictionary& dictionary, fs::path const& file, fs::path const& snapshot) {
+   TMyMappedFile mapping(file);
+   auto const hash = model_hash(mapping.Text());
+   if (dictionary.LoadSnapshot(snapshot, hash)) return;
+   LoadModelText(dictionary, mapping.Text(), file.string());
+   dictionary.SaveSnapshot(snapshot, hash);
+   }
+
+void LoadModelText(TMyDictionary& dictionary, std::string_view text, std::string const& strName) {
+   my_statement stmt(strName);
+   my_context   context { dictionary };
+
+   if (text.starts_with("\xEF\xBB\xBF"sv)) [[unlikely]]
+      throw std::runtime_error("model file \""s + strName + "\" has an UTF-8 BOM, the model is expected in Windows-1252."s);
+
+   for (size_t iLine = 1; !text.empty(); ++iLine) {
+      auto const end = text.find('\n');
+      auto line = text.substr(0, end);
+      text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+      if (line.ends_with('\r')) line.remove_suffix(1);
+
+      if (!stmt.Parse(line, iLine)) continue;
+
+      auto it = std::ranges::find(keywords, stmt.Keyword(), &my_keyword::keyword);
+      if (it == keywords.end()) [[unlikely]] stmt.Error("unknown statement \""s + std::string(stmt.Keyword()) + "\"."s);
+      if (stmt.Count() < it->iMinArgs || stmt.Count() > it->iMaxArgs) [[unlikely]]
+         stmt.Error(std::string(stmt.Keyword()) + " with "s + std::to_string(stmt.Count()) + " arguments, expected "s +
+                    std::to_string(it->iMinArgs) + (it->iMaxArgs == it->iMinArgs ? ""s :
+                                                    it->iMaxArgs == unlimited ? " or more"s : " to "s + std::to_string(it->iMaxArgs)) + "."s);
+      try {
+         it->handler(context, stmt);
+         }
+      catch (my_model_error const&) {
+         throw;
+         }
+      catch (std::exception const& ex) {  // errors of the checks in the dictionary get the position of the statement
+         stmt.Error(ex.what());
+         }
+      }
+   }
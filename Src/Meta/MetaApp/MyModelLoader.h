@@ -0,0 +1,52 @@
+#pragma once
+/** \file
+   \brief loader for declarative model files into a TMyDictionary
+   \details a model file describes a dictionary without C++ code, the generator doesn't need a new build
+            for a changed model. every line is one statement, the keyword is the name of the manipulator of
+            TMyDictionary or TMyTable, the arguments follow in the sequence of the parameters of this method.
+            so all statements go through the same checks like a dictionary in source (e.g. TDictionary_Test).
+            - arguments are separated by spaces or tabs, arguments with spaces are enclosed in quotation
+              marks, inside them \\" \\\\ \\n and \\t are escape sequences. a backslash in an argument without
+              quotation marks is a normal character (paths like System\\Corporate).
+            - "#" at the begin of a line starts a comment, empty lines are ignored.
+            - the statements for tables (AddAttribute, AddReference, AddIndex, AddRangeValue, AddPostConditions,
+              AddCleanings, AddDescription, AddComment, OwnContainerType) refer to the table of the last AddTable.
+            - bool values as true / false, enums with the names of the enumerators (e.g. composition),
+              "-" for an empty optional value (the show attribute of references).
+            - values of references as pairs attribute:referenced attribute (1:1), values of indices as
+              pairs attribute:ascending (4:true).
+            the file is expected in Windows-1252 like the sources, the generators convert the output to UTF-8.
+            the file is memory mapped and the arguments are views into the mapping, only arguments with escape
+            sequences are copied. errors are reported as std::runtime_error with "file(line): message".
+   \code
+   # simple model
+   Name "simple person model"
+   AddDataType integer INT false false false "" int "" i long "" false "the INT data type ..."
+   AddTable Address table Address dbo Address myCorporate System\Corporate SQL "information on the addresses"
+      AddAttribute 1 ID ID integer 0 0 true true "" "" "" "key attribute"
+      AddReference Address2Person composition Person "residential address" "1 : n" - "part of" 1:1
+      AddIndex Address_City_Street undefined "search for city / street" 4:true 5:true
+   \endcode
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to load models without a new build of the generator
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "DataDictionary.h"
+
+#include <string>
+#include <string_view>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+/// \brief load the model file into the dictionary, the file is memory mapped
+void LoadModelFile(TMyDictionary& dictionary, fs::path const& file);
+
+/// \brief load the model file with a binary snapshot as cache, the snapshot is written again when the model file changed
+void LoadModelFile(TMyDictionary& dictionary, fs::path const& file, fs::path const& snapshot);
+
+/// \brief load the model in text into the dictionary, strName is used as file name in messages
+void LoadModelText(TMyDictionary& dictionary, std::string_view text, std::string const& strName);
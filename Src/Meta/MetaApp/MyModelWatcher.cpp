@@ -0,0 +1,130 @@
+/** \file
+   \brief implementation of the resident generator which watches a model file
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for a generator which runs beside the editor of the model
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyModelWatcher.h"
+#include "MyModelLoader.h"
+#include "MyOutputWriter.h"
+
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+using namespace std::string_literals;
+
+namespace {
+   /// \brief add the changed tables and all tables depending on them in the dictionary to tables
+   void add_dependents(TMyDictionary const& dictionary, std::set<std::string> const& changed, std::set<std::string>& tables) {
+      for (auto const& name : changed) {
+         auto it = dictionary.Tables().find(name);
+         if (it == dictionary.Tables().end()) continue;   // new or removed table
+         auto const& table = it->second;
+
+         tables.insert(name);
+         tables.merge(table.GetSuccessors(true));
+         for (auto const& ref : table.References()) tables.insert(ref.RefTable());
+         for (size_t iType = 0; iType < TMyDictionary::iReferenceTypes; ++iType) {
+            for (auto const& [referrer, reference] : dictionary.Referrers(table, static_cast<EMyReferenceType>(iType))) tables.insert(referrer->Name());
+            }
+         }
+      }
+   }
+
+
+TMyModelWatcher::TMyModelWatcher(fs::path const& pModel, TMyOutputBackend* pTarget, std::ostream& pOut, std::ostream& pErr) :
+                                   pathModel(pModel), pOutput(pTarget), out(pOut), err(pErr) { }
+
+TMyDictionary const& TMyModelWatcher::Dictionary() const {
+   if (!dictionary) [[unlikely]] throw std::runtime_error("the watcher for \""s + pathModel.string() + "\" has no dictionary yet."s);
+   return *dictionary;
+   }
+
+bool TMyModelWatcher::Update() {
+   std::error_code ec;
+   auto const time = fs::last_write_time(pathModel, ec);
+   if (ec || (dictionary && time == last_write)) return false;
+
+   // a model with errors is noted as processed, the watcher waits for the next change of the file
+   last_write = time;
+   try {
+      auto const start = std::chrono::steady_clock::now();
+      auto const artifacts = Apply([this](TMyDictionary& dict) { LoadModelFile(dict, pathModel); });
+      auto const time_used = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      if (!artifacts.boProjectFiles && !artifacts.boModelFiles) out << std::format("model {} without changes\n", pathModel.string());
+      else if (artifacts.tables) out << std::format("model {} changed, {} tables created again in {:.1f} ms\n", pathModel.string(), artifacts.tables->size(), time_used);
+      else out << std::format("model {} created in {:.1f} ms\n", pathModel.string(), time_used);
+      return true;
+      }
+   catch (std::exception& ex) {
+      err << ex.what() << '\n';
+      return false;
+      }
+   }
+
+void TMyModelWatcher::Run(std::stop_token token, std::chrono::milliseconds interval) {
+   while (!token.stop_requested()) {
+      Update();
+      std::this_thread::sleep_for(interval);
+      }
+   }
+
+TMyDictionary::my_artifacts TMyModelWatcher::Apply(load_func const& load) {
+   auto next = std::make_unique<TMyDictionary>();
+   load(*next);
+   next->Link();
+
+   auto const iNextSettings = next->Fingerprint();
+   std::map<std::string, uint64_t> next_prints;
+   for (auto const& [name, table] : next->Tables()) next_prints.emplace_hint(next_prints.end(), name, table.Fingerprint());
+
+   auto artifacts = dictionary ? Affected(*dictionary, iSettings, fingerprints, *next, iNextSettings, next_prints)
+                               : TMyDictionary::my_artifacts { };
+   // the statements of the unaffected tables are taken from the last run, so only the affected tables are rendered again
+   if (dictionary && artifacts.tables) next->sql_builder().TakeStatements(dictionary->sql_builder(), *artifacts.tables);
+   if (artifacts.boProjectFiles || artifacts.boModelFiles) {
+      if (pOutput != nullptr) next->Create_Selected(*pOutput, artifacts, out, err);
+      else {
+         TMyOutputWriter writer(next->ManifestFile());
+         next->Create_Selected(writer, artifacts, out, err);
+         }
+      }
+
+   dictionary   = std::move(next);
+   iSettings    = iNextSettings;
+   fingerprints = std::move(next_prints);
+   return artifacts;
+   }
+
+TMyDictionary::my_artifacts TMyModelWatcher::Affected(TMyDictionary const& before, uint64_t iBeforeSettings,
+                                                      std::map<std::string, uint64_t> const& before_prints,
+                                                      TMyDictionary const& after, uint64_t iAfterSettings,
+                                                      std::map<std::string, uint64_t> const& after_prints) {
+   if (iBeforeSettings != iAfterSettings) return { };   // all files
+
+   // changed, new and removed tables with one pass over both sorted maps
+   std::set<std::string> changed;
+   auto lhs = before_prints.begin();
+   auto rhs = after_prints.begin();
+   while (lhs != before_prints.end() || rhs != after_prints.end()) {
+      if (rhs == after_prints.end() || (lhs != before_prints.end() && lhs->first < rhs->first)) changed.insert((lhs++)->first);
+      else if (lhs == before_prints.end() || rhs->first < lhs->first) changed.insert((rhs++)->first);
+      else {
+         if (lhs->second != rhs->second) changed.insert(lhs->first);
+         ++lhs;
+         ++rhs;
+         }
+      }
+
+   TMyDictionary::my_artifacts artifacts { .boProjectFiles = false, .boModelFiles = !changed.empty(), .tables = std::set<std::string> { } };
+   // dependencies of the old model for removed references, of the new model for added references
+   add_dependents(before, changed, *artifacts.tables);
+   add_dependents(after, changed, *artifacts.tables);
+   std::erase_if(*artifacts.tables, [&after](std::string const& name) { return !after.Tables().contains(name); });
+   return artifacts;
+   }
@@ -0,0 +1,92 @@
+#pragma once
+/** \file
+   \brief resident generator which watches a model file and creates only the files affected by a change
+   \details the watcher keeps the linked dictionary of the last run and the fingerprints of the tables in memory.
+            after a change of the model file the model is loaded into a new dictionary, the fingerprints show the
+            changed, new and removed tables. the files of a changed table are created again together with the
+            files of all tables which depend on it in the old or the new model:
+            - the successors of the table (generalization, composition, range) with all their successors,
+              they use the attributes of their precursors
+            - the tables with a reference to the table and the tables referenced by the table, their headers
+              and documentation show the relationships
+            the files with all tables (sql scripts, documentation of the project, reader, corba idl) are created
+            with every change of a table, the files which depend only on the settings only when the settings,
+            datatypes, namespaces or directories changed. in this case all files are created. files of removed
+            tables stay in the filesystem.
+            costs of a change: the model file is loaded and linked completely and the fingerprints of all tables are
+            built, this is linear in the size of the model without generation. the sql statements of the unaffected
+            tables are taken from the cache of the last run, only the statements and the header, source and dox files
+            of the affected tables are rendered. the files with all tables are assembled from the cache, the output
+            writer compares them with the last content and writes only the changed files.
+   \code
+   TMyModelWatcher watcher("persons.model");
+   watcher.Run(std::stop_token { });   // runs until the process ends
+   \endcode
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for a generator which runs beside the editor of the model
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "DataDictionary.h"
+#include "MyOutputBackend.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <ostream>
+#include <iostream>
+#include <functional>
+#include <filesystem>
+#include <stop_token>
+
+namespace fs = std::filesystem;
+
+class TMyModelWatcher {
+public:
+   using load_func = std::function<void (TMyDictionary&)>;   ///< fills an empty dictionary with the model
+
+private:
+   fs::path                         pathModel;               ///< watched model file, empty when the model is passed with Apply
+   TMyOutputBackend*                pOutput;                 ///< target of the files, nullptr = TMyOutputWriter with ManifestFile()
+   std::ostream&                    out;                     ///< protocol of the runs
+   std::ostream&                    err;                     ///< errors of the model and the generators
+   std::unique_ptr<TMyDictionary>   dictionary;              ///< resident linked dictionary of the last run
+   uint64_t                         iSettings = 0;           ///< fingerprint of the dictionary without the tables
+   std::map<std::string, uint64_t>  fingerprints;            ///< fingerprints of the tables of the last run
+   fs::file_time_type               last_write { };          ///< time of the model file for the last run
+
+public:
+   explicit TMyModelWatcher(fs::path const& pModel = { }, TMyOutputBackend* pTarget = nullptr,
+                            std::ostream& pOut = std::cout, std::ostream& pErr = std::cerr);
+   TMyModelWatcher(TMyModelWatcher const&) = delete;
+   ~TMyModelWatcher() = default;
+
+   /** \name selectors for class TMyModelWatcher
+       \{ */
+   fs::path const& Model() const { return pathModel; }
+   bool            HasDictionary() const { return dictionary != nullptr; }
+   /// \brief dictionary of the last successful run, exception without a run
+   TMyDictionary const& Dictionary() const;
+   /// \}
+
+   /// \brief load the model file again when it changed since the last run
+   /// \returns true when the model was loaded and the files were created, errors of the model are written to err
+   bool Update();
+
+   /// \brief watch the model file, Update is called every interval until stop is requested
+   void Run(std::stop_token token, std::chrono::milliseconds interval = std::chrono::milliseconds { 250 });
+
+   /// \brief replace the model with the model created by load and create the affected files
+   /// \returns the selection of the created files
+   TMyDictionary::my_artifacts Apply(load_func const& load);
+
+   /// \brief files affected by the change from dictionary before to after, the fingerprints belong to the tables of before
+   static TMyDictionary::my_artifacts Affected(TMyDictionary const& before, uint64_t iBeforeSettings,
+                                               std::map<std::string, uint64_t> const& before_prints,
+                                               TMyDictionary const& after, uint64_t iAfterSettings,
+                                               std::map<std::string, uint64_t> const& after_prints);
+   };
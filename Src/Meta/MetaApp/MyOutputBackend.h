@@ -0,0 +1,43 @@
+#pragma once
+/** \file
+   \brief interface for the target of the files of the metadata generator
+   \details TMyDictionary::Create_All doesn't write the generated files itself, it passes the rendered content
+            to an output backend. the backend for the filesystem is TMyOutputWriter, which writes only files
+            with changed content. TMyMemoryOutput holds all files in memory, for benchmarks without noise of the
+            disk, for tests without temporary directories or to write the complete output as one archive.
+            the methods are called parallel by the worker threads of Create_All, a backend must be thread safe.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created to exchange the target of Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <filesystem>
+
+#include "MyTextBuffer.h"
+
+namespace fs = std::filesystem;
+
+class TMyOutputBackend {
+public:
+   virtual ~TMyOutputBackend() = default;
+
+   /** \name selectors for class TMyOutputBackend
+       \{ */
+   /// \brief count of written files
+   virtual size_t Written() const = 0;
+   /// \brief count of files with unchanged content, these files weren't written again
+   virtual size_t Unchanged() const = 0;
+   /// \}
+
+   /// \brief create the directory with all parents, called once for every directory before the files in it are written
+   virtual void CreateDirectories(fs::path const& path) = 0;
+
+   /// \brief write the content of a text buffer into the file
+   /// \returns true when the file was written, false when the content was unchanged
+   virtual bool Write(fs::path const& file, TMyTextBuffer const& content) = 0;
+
+   /// \brief called once after all files are written
+   virtual void Save() const = 0;
+   };
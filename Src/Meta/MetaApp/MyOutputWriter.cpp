@@ -0,0 +1,171 @@
+/** \file
+   \brief implementation of the incremental writer for the files of the metadata generator
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for incremental generation in TMyDictionary::Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyOutputWriter.h"
+
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <optional>
+#include <array>
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace {
+   /// text in front of generator time stamps in the generated files, banners and doxygen pages
+   constexpr std::array<std::string_view, 3> stamp_markers = { "Date: "sv, "generated at: "sv, "\\date "sv };
+
+   /// \brief true when the text at pos matches the pattern, 'd' in the pattern is a digit
+   template <typename text_ty>
+   bool matches(text_ty const& text, size_t size, size_t pos, std::string_view pattern) {
+      if (size - pos < pattern.size()) return false;
+      for (size_t i = 0; i < pattern.size(); ++i) {
+         char const c = text[pos + i];
+         if (pattern[i] == 'd' ? (c < '0' || c > '9') : pattern[i] != c) return false;
+         }
+      return true;
+      }
+
+   /// \brief true when a marker ends directly before pos
+   template <typename text_ty>
+   bool marker_before(text_ty const& text, size_t pos) {
+      return std::ranges::any_of(stamp_markers, [&text, pos](std::string_view marker) {
+         if (pos < marker.size()) return false;
+         for (size_t i = 0; i < marker.size(); ++i) if (text[pos - marker.size() + i] != marker[i]) return false;
+         return true;
+         });
+      }
+
+   /// \brief length of a time stamp "dd.mm.yyyy" or "dd.mm.yyyy hh:mm:ss,mmm" at pos, 0 when there is none
+   template <typename text_ty>
+   size_t stamp_length(text_ty const& text, size_t size, size_t pos) {
+      static constexpr std::string_view date_pattern = "dd.dd.dddd"sv;
+      static constexpr std::string_view time_pattern = " dd:dd:dd,ddd"sv;
+      if (!matches(text, size, pos, date_pattern)) return 0;
+      else if (matches(text, size, pos + date_pattern.size(), time_pattern)) return date_pattern.size() + time_pattern.size();
+      else return date_pattern.size();
+      }
+
+   /// \brief FNV-1a hash for text with random access, string_view or TMyTextBuffer
+   /// \details every time stamp directly behind a marker is skipped, the doxygen pages contain a \\date for
+   ///          every documented file. the marker and the rest of the line are part of the hash
+   template <typename text_ty>
+   TMyOutputWriter::hash_type hash_text(text_ty const& text, size_t size) {
+      TMyOutputWriter::hash_type hash = 14'695'981'039'346'656'037ull;
+      for (size_t pos = 0; pos < size; ) {
+         if (char const c = text[pos]; c >= '0' && c <= '9' && marker_before(text, pos)) {
+            if (auto len = stamp_length(text, size, pos); len > 0) {
+               pos += len;
+               continue;
+               }
+            }
+         hash ^= static_cast<unsigned char>(text[pos++]);
+         hash *= 1'099'511'628'211ull;
+         }
+      return hash;
+      }
+
+   std::string read_file(fs::path const& file) {
+      std::ifstream ifs(file);
+      if (!ifs) [[unlikely]] throw std::runtime_error("error when opening the file \""s + file.string() + "\" to compare."s);
+      return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+      }
+   }
+
+
+TMyOutputWriter::TMyOutputWriter(fs::path const& pManifest) : pathManifest(pManifest) {
+   if (pathManifest.empty() || !fs::exists(pathManifest)) return;
+
+   std::ifstream ifs(pathManifest);
+   std::string line;
+   while (std::getline(ifs, line)) {
+      std::istringstream ins(line);
+      manifest_entry entry;
+      std::string strFile;
+      if (ins >> std::hex >> entry.hash >> std::dec >> entry.last_write && std::getline(ins >> std::ws, strFile)) {
+         manifest.insert_or_assign(strFile, entry);
+         }
+      }
+   }
+
+
+TMyOutputWriter::hash_type TMyOutputWriter::Hash(std::string_view content) {
+   return hash_text(content, content.size());
+   }
+
+TMyOutputWriter::hash_type TMyOutputWriter::Hash(TMyTextBuffer const& content) {
+   return hash_text(content, content.Size());
+   }
+
+
+void TMyOutputWriter::CreateDirectories(fs::path const& path) {
+   fs::create_directories(path);
+   }
+
+bool TMyOutputWriter::Write(fs::path const& file, std::string_view content) {
+   return Write(file, Hash(content), [content](std::ostream& os) { os.write(content.data(), content.size()); });
+   }
+
+bool TMyOutputWriter::Write(fs::path const& file, TMyTextBuffer const& content) {
+   return Write(file, Hash(content), [&content](std::ostream& os) { content.Write(os); });
+   }
+
+bool TMyOutputWriter::Write(fs::path const& file, hash_type hash, std::function<void (std::ostream&)> const& write_content) {
+   auto const key  = file.generic_string();
+
+   std::error_code ec;
+   if (auto last_write = fs::last_write_time(file, ec); !ec) {
+      std::optional<hash_type> old_hash;
+      {
+         std::lock_guard lock(mtxManifest);
+         if (auto it = manifest.find(key); it != manifest.end() && it->second.last_write == last_write.time_since_epoch().count())
+            old_hash = it->second.hash;
+      }
+
+      // without a valid entry in the manifest the existing file is the reference
+      if (!old_hash) old_hash = Hash(read_file(file));
+
+      if (*old_hash == hash) {
+         std::lock_guard lock(mtxManifest);
+         manifest.insert_or_assign(key, manifest_entry { hash, last_write.time_since_epoch().count() });
+         ++iUnchanged;
+         return false;
+         }
+      }
+
+   std::ofstream ofs(file);
+   if (!ofs) [[unlikely]] throw std::runtime_error("error when opening the file \""s + file.string() + "\"."s);
+   write_content(ofs);
+   ofs.close();
+   if (!ofs) [[unlikely]] throw std::runtime_error("error when writing the file \""s + file.string() + "\"."s);
+
+   {
+      std::lock_guard lock(mtxManifest);
+      manifest.insert_or_assign(key, manifest_entry { hash, fs::last_write_time(file).time_since_epoch().count() });
+   }
+   ++iWritten;
+   return true;
+   }
+
+
+void TMyOutputWriter::Save() const {
+   if (pathManifest.empty()) return;
+
+   std::ofstream ofs(pathManifest);
+   if (!ofs) [[unlikely]] throw std::runtime_error("error when opening the manifest file \""s + pathManifest.string() + "\"."s);
+
+   std::lock_guard lock(mtxManifest);
+   for (auto const& [strFile, entry] : manifest) {
+      ofs << std::format("{:016x} {} {}\n", entry.hash, entry.last_write, strFile);
+      }
+   }
@@ -0,0 +1,83 @@
+#pragma once
+/** \file
+   \brief incremental writer for the files of the metadata generator
+   \details the generators render the content of a file into memory. the writer builds a hash of the
+            content and compares it with the hash of the previous run (manifest) or with the existing
+            file. only files with changed content are written, so the modification time of unchanged
+            files stays and the following build doesn't need to compile them again. the time stamps of the
+            generator (a date directly after "Date: ", "generated at: " or "\\date ") are excluded from the
+            hash, the rest of these lines is part of the content. the writer is the default output backend
+            of TMyDictionary::Create_All.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for incremental generation in TMyDictionary::Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <string_view>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+
+#include "MyTextBuffer.h"
+#include "MyOutputBackend.h"
+
+namespace fs = std::filesystem;
+
+class TMyOutputWriter : public TMyOutputBackend {
+public:
+   using hash_type = uint64_t;
+
+private:
+   /// \brief entry for a file in the manifest of the previous run
+   struct manifest_entry {
+      hash_type  hash;                           ///< hash of the content without time stamps
+      fs::file_time_type::rep last_write;        ///< time of the last write, to detect foreign changes
+      };
+
+   fs::path                               pathManifest;    ///< file with the hashes of the previous run, empty = compare with the files
+   std::map<std::string, manifest_entry>  manifest;        ///< hashes of the files, key is the generic path
+   mutable std::mutex                     mtxManifest;     ///< lock for the manifest, files are written parallel
+   std::atomic<size_t>                    iWritten   = 0;  ///< count of written files
+   std::atomic<size_t>                    iUnchanged = 0;  ///< count of unchanged files
+
+public:
+   explicit TMyOutputWriter(fs::path const& pManifest = { });
+   TMyOutputWriter(TMyOutputWriter const&) = delete;
+   ~TMyOutputWriter() override = default;
+
+   /** \name selectors for class TMyOutputWriter
+       \{ */
+   fs::path const& Manifest() const { return pathManifest; }
+   size_t          Written() const override { return iWritten.load(); }
+   size_t          Unchanged() const override { return iUnchanged.load(); }
+   /// \}
+
+   /// \brief create the directory with all parents in the filesystem
+   void CreateDirectories(fs::path const& path) override;
+
+   /// \brief write the content to the file when it is different to the existing file
+   /// \details the content is written without conversion, use TMyUTF8Stream to create UTF-8 content
+   /// \returns true when the file was written, false when the content was unchanged
+   bool Write(fs::path const& file, std::string_view content);
+
+   /// \brief write the content of a text buffer, the chunks are written without joining them
+   bool Write(fs::path const& file, TMyTextBuffer const& content) override;
+
+   /// \brief save the manifest for the next run, nothing happens when no manifest file defined
+   void Save() const override;
+
+   /// \brief FNV-1a hash for the content, the generator time stamps behind the markers are skipped
+   static hash_type Hash(std::string_view content);
+   static hash_type Hash(TMyTextBuffer const& content);
+
+private:
+   /// \brief common part of Write, write_content is called only when the hash differs
+   bool Write(fs::path const& file, hash_type hash, std::function<void (std::ostream&)> const& write_content);
+   };
@@ -0,0 +1,65 @@
+/** \file
+   \brief implementation of the arena for the texts of the dictionary
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as storage for the comments and descriptions of the dictionary
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyStringArena.h"
+
+#include <string>
+#include <cstring>
+
+std::string_view TMyStringArena::Store(std::string_view text) {
+   if (text.empty()) return { };
+   std::scoped_lock lock(mtxArena);
+   if (auto it = texts.find(text); it != texts.end()) return *it;
+
+   char* target;
+   if (text.size() > iBlockSize / 4) {
+      // large texts get an own block before the current, so the free space of the current block stays usable
+      auto block = std::make_unique_for_overwrite<char[]>(text.size());
+      target = block.get();
+      blocks.insert(blocks.empty() ? blocks.end() : blocks.end() - 1, std::move(block));
+      }
+   else {
+      if (text.size() > iFree) {
+         blocks.emplace_back(std::make_unique_for_overwrite<char[]>(iBlockSize));
+         iFree = iBlockSize;
+         }
+      target = blocks.back().get() + (iBlockSize - iFree);
+      iFree -= text.size();
+      }
+   std::memcpy(target, text.data(), text.size());
+   iBytes += text.size();
+   return *texts.emplace(target, text.size()).first;
+   }
+
+std::string_view TMyStringArena::Concat(std::string_view first, std::string_view separator, std::string_view second) {
+   if (first.empty()) return Store(second);
+   {
+      std::scoped_lock lock(mtxArena);
+      auto const iAdd = separator.size() + second.size();
+      if (!blocks.empty() && iAdd <= iFree) {
+         char* const begin = blocks.back().get();
+         char* const end   = begin + (iBlockSize - iFree);
+         if (first.data() >= begin && first.data() + first.size() == end) {
+            // first is the last text in the current block, the parts are written behind it. the characters of
+            // first stay unchanged, so first is still valid for all other users
+            std::memcpy(end, separator.data(), separator.size());
+            std::memcpy(end + separator.size(), second.data(), second.size());
+            std::string_view text(first.data(), first.size() + iAdd);
+            if (auto it = texts.find(text); it != texts.end()) return *it;   // the written characters stay free
+            iFree  -= iAdd;
+            iBytes += iAdd;
+            return *texts.emplace(text).first;
+            }
+         }
+   }
+   std::string strText;
+   strText.reserve(first.size() + separator.size() + second.size());
+   strText.append(first).append(separator).append(second);
+   return Store(strText);
+   }
@@ -0,0 +1,51 @@
+#pragma once
+/** \file
+   \brief arena for the texts of the dictionary, deduplicated and with stable string_view handles
+   \details the texts are copied into blocks of fixed size with a bump allocator, a block is never moved
+            or released before the arena, so the returned std::string_view stay valid for the lifetime of
+            the arena. equal texts are stored only once, this is used for repeated comments and
+            descriptions of the entities.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as storage for the comments and descriptions of the dictionary
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_set>
+#include <mutex>
+
+class TMyStringArena {
+public:
+   static constexpr size_t iBlockSize = 64 * 1024;   ///< size of a block, larger texts get an own block
+
+private:
+   std::vector<std::unique_ptr<char[]>> blocks;           ///< storage, the last block is the current
+   size_t                               iFree = 0;        ///< free characters at the end of the current block
+   size_t                               iBytes = 0;       ///< count of stored characters
+   std::unordered_set<std::string_view> texts;            ///< stored texts for the deduplication
+   mutable std::mutex                   mtxArena;         ///< lock for Store, the dictionary is filled by parallel readers
+
+public:
+   TMyStringArena() = default;
+   TMyStringArena(TMyStringArena const&) = delete;
+   ~TMyStringArena() = default;
+
+   /** \name selectors for class TMyStringArena
+       \{ */
+   size_t Size() const { std::scoped_lock lock(mtxArena); return texts.size(); }     ///< count of different texts
+   size_t Bytes() const { std::scoped_lock lock(mtxArena); return iBytes; }          ///< characters of the different texts
+   size_t Blocks() const { std::scoped_lock lock(mtxArena); return blocks.size(); }  ///< count of allocated blocks
+   /// \}
+
+   /// \brief copy text into the arena, an equal text which is already stored is reused
+   std::string_view Store(std::string_view text);
+
+   /// \brief stored text of two parts with separator, used to add lines to comments and descriptions
+   /// \details when first is the last text in the current block, the parts are appended in place, so a text
+   ///          extended line by line is stored once and not as a copy for every line
+   std::string_view Concat(std::string_view first, std::string_view separator, std::string_view second);
+   };
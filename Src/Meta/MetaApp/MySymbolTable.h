@@ -0,0 +1,61 @@
+#pragma once
+/** \file
+   \brief table with interned names and dense integer ids for the link step of the dictionary
+   \details every name gets an id in the sequence of Intern, starting with 0. the ids can be used as
+            index for vectors with additional data, so lookups after the link step don't need to compare strings.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created for the link step of TMyDictionary
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+
+using namespace std::string_literals;
+
+class TMySymbolTable {
+public:
+   using symbol_id = uint32_t;                                            ///< dense id for a name
+   static constexpr symbol_id npos = std::numeric_limits<symbol_id>::max(); ///< id for unknown names
+
+private:
+   std::deque<std::string>                          names;  ///< interned names, index is the id, deque keeps the addresses stable
+   std::unordered_map<std::string_view, symbol_id>  ids;    ///< ids for the names, the keys refer to the elements in names
+
+public:
+   TMySymbolTable() = default;
+   TMySymbolTable(TMySymbolTable const&) = delete;
+   TMySymbolTable(TMySymbolTable&&) noexcept = default;
+   ~TMySymbolTable() = default;
+
+   /** \name selectors for class TMySymbolTable
+       \{ */
+   size_t Size() const { return names.size(); }
+
+   std::string const& Name(symbol_id id) const {
+      if (id >= names.size()) [[unlikely]] throw std::runtime_error("symbol with id "s + std::to_string(id) + " couldn't found."s);
+      else return names[id];
+      }
+
+   /// \brief id for a name, npos when the name isn't interned
+   symbol_id Find(std::string_view name) const {
+      if (auto it = ids.find(name); it != ids.end()) return it->second;
+      else return npos;
+      }
+   /// \}
+
+   /// \brief intern a name and return the id, a known name keeps its id
+   symbol_id Intern(std::string_view name) {
+      if (auto it = ids.find(name); it != ids.end()) return it->second;
+      auto const id = static_cast<symbol_id>(names.size());
+      ids.emplace(names.emplace_back(name), id);
+      return id;
+      }
+   };
@@ -0,0 +1,84 @@
+/** \file
+   \brief implementation of the chunked text buffer and output stream for the generators
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as common target for the generators in TMyDictionary::Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyTextBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+std::vector<std::string_view> TMyTextBuffer::Chunks() const {
+   std::vector<std::string_view> parts;
+   parts.reserve(chunks.size());
+   for (size_t pos = 0; pos < iSize; pos += iChunkSize) {
+      parts.emplace_back(chunks[pos / iChunkSize].get(), std::min(iChunkSize, iSize - pos));
+      }
+   return parts;
+   }
+
+std::string TMyTextBuffer::Str() const {
+   std::string strText;
+   strText.reserve(iSize);
+   for (auto part : Chunks()) strText.append(part);
+   return strText;
+   }
+
+void TMyTextBuffer::Write(std::ostream& os) const {
+   for (auto part : Chunks()) os.write(part.data(), part.size());
+   }
+
+void TMyTextBuffer::Append(std::string_view text) {
+   while (!text.empty()) {
+      auto space = Reserve();
+      auto const count = std::min(space.size(), text.size());
+      std::memcpy(space.data(), text.data(), count);
+      Commit(count);
+      text.remove_prefix(count);
+      }
+   }
+
+std::span<char> TMyTextBuffer::Reserve() {
+   if (iSize % iChunkSize == 0 && iSize / iChunkSize == chunks.size()) NewChunk();
+   return { chunks[iSize / iChunkSize].get() + iSize % iChunkSize, iChunkSize - iSize % iChunkSize };
+   }
+
+
+TMyTextStreamBuf::int_type TMyTextStreamBuf::overflow(int_type ch) {
+   sync();
+   if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+      }
+   return traits_type::not_eof(ch);
+   }
+
+std::streamsize TMyTextStreamBuf::xsputn(char const* text, std::streamsize count) {
+   if (count <= epptr() - pptr()) {
+      std::memcpy(pptr(), text, static_cast<size_t>(count));
+      pbump(static_cast<int>(count));
+      }
+   else {
+      buffer.Commit(static_cast<size_t>(pptr() - pbase()));
+      buffer.Append(std::string_view(text, static_cast<size_t>(count)));
+      Arm();
+      }
+   return count;
+   }
+
+int TMyTextStreamBuf::sync() {
+   // the written characters are already in the chunk, they are only taken into the text,
+   // the free space behind them is the next put area
+   buffer.Commit(static_cast<size_t>(pptr() - pbase()));
+   Arm();
+   return 0;
+   }
+
+void TMyTextStreamBuf::Arm() {
+   auto space = buffer.Reserve();
+   setp(space.data(), space.data() + space.size());
+   }
@@ -0,0 +1,122 @@
+#pragma once
+/** \file
+   \brief chunked text buffer and output stream for the generators of the metadata generator
+   \details the generators write into a std::ostream. the stream buffer of TMyTextStream uses the free
+            space of the current chunk as put area, so the characters are written directly into the
+            buffer without a copy. the buffer grows in chunks of fixed size, existing text is never
+            moved. out_format formats directly into the stream without a temporary string.
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as common target for the generators in TMyDictionary::Create_All
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <span>
+#include <streambuf>
+#include <ostream>
+#include <iterator>
+#include <format>
+
+class TMyTextBuffer {
+public:
+   using value_type = char;                            ///< for std::back_inserter
+   static constexpr size_t iChunkSize = 64 * 1024;    ///< size of a chunk, a complete chunk is written with one call
+
+private:
+   std::vector<std::unique_ptr<char[]>> chunks;   ///< storage, all chunks except the last are complete
+   size_t                               iSize = 0; ///< count of characters in the buffer
+
+public:
+   TMyTextBuffer() = default;
+   TMyTextBuffer(TMyTextBuffer const&) = delete;
+   TMyTextBuffer(TMyTextBuffer&&) noexcept = default;
+   ~TMyTextBuffer() = default;
+
+   /** \name selectors for class TMyTextBuffer
+       \{ */
+   size_t Size() const { return iSize; }
+   bool   Empty() const { return iSize == 0; }
+   char   operator [] (size_t pos) const { return chunks[pos / iChunkSize][pos % iChunkSize]; }
+   char   Back() const { return (*this)[iSize - 1]; }
+
+   /// \brief the text as sequence of contiguous parts, valid until the next change
+   std::vector<std::string_view> Chunks() const;
+
+   /// \brief the complete text as string, copies the content
+   std::string Str() const;
+
+   /// \brief write the text to the stream, one write for each chunk
+   void Write(std::ostream& os) const;
+   /// \}
+
+   /** \name manipulators for class TMyTextBuffer
+       \{ */
+   void push_back(char ch) {
+      if (iSize % iChunkSize == 0 && iSize / iChunkSize == chunks.size()) [[unlikely]] NewChunk();
+      chunks[iSize / iChunkSize][iSize % iChunkSize] = ch;
+      ++iSize;
+      }
+
+   void Append(std::string_view text);
+   void Clear() { chunks.clear(); iSize = 0; }
+
+   /// \brief free space in the current chunk, a new chunk is added when the current is full
+   std::span<char> Reserve();
+
+   /// \brief take count characters from the space of Reserve into the text
+   void Commit(size_t count) { iSize += count; }
+
+   /// \brief format directly into the buffer
+   template <typename... args_ty>
+   void Format(std::format_string<args_ty...> fmt, args_ty&&... args) {
+      std::format_to(std::back_inserter(*this), fmt, std::forward<args_ty>(args)...);
+      }
+   /// \}
+
+private:
+   void NewChunk() { chunks.emplace_back(std::make_unique_for_overwrite<char[]>(iChunkSize)); }
+   };
+
+
+/// \brief stream buffer which writes directly into the chunks of a TMyTextBuffer
+class TMyTextStreamBuf : public std::streambuf {
+   TMyTextBuffer& buffer;   ///< target for the text
+public:
+   explicit TMyTextStreamBuf(TMyTextBuffer& pBuffer) : buffer(pBuffer) { Arm(); }
+   TMyTextStreamBuf(TMyTextStreamBuf const&) = delete;
+   ~TMyTextStreamBuf() override { sync(); }
+
+protected:
+   int_type        overflow(int_type ch) override;
+   std::streamsize xsputn(char const* text, std::streamsize count) override;
+   int             sync() override;
+
+private:
+   /// \brief the free space of the current chunk becomes the put area, the characters in it aren't taken into the text
+   void Arm();
+   };
+
+
+/// \brief output stream for generators into a chunked text buffer
+class TMyTextStream : public std::ostream {
+   TMyTextBuffer    text;           ///< written text
+   TMyTextStreamBuf buf { text };   ///< stream buffer into the chunks of text
+public:
+   TMyTextStream() : std::ostream(nullptr) { rdbuf(&buf); }
+   TMyTextStream(TMyTextStream const&) = delete;
+
+   /// \brief the written text, the stream is flushed before
+   TMyTextBuffer const& Text() { flush(); return text; }
+   };
+
+
+/// \brief format directly into the stream buffer of os, without a temporary string like os << std::format(...)
+template <typename... args_ty>
+inline void out_format(std::ostream& os, std::format_string<args_ty...> fmt, args_ty&&... args) {
+   std::format_to(std::ostreambuf_iterator<char>(os), fmt, std::forward<args_ty>(args)...);
+   }
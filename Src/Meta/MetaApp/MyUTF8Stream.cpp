@@ -0,0 +1,126 @@
+/** \file
+   \brief implementation of the output stream which converts the text of the generators to UTF-8 with BOM
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as portable replacement for convertToUTF8WithBOM
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include "MyUTF8Stream.h"
+
+#include <cstdint>
+#include <cstring>
+#include <bit>
+
+using namespace std::string_view_literals;
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+   #include <emmintrin.h>
+   #define MY_UTF8_SSE2 1
+#endif
+
+namespace {
+   /// \brief UTF-8 sequence for a character beyond ASCII
+   struct utf8_sequence {
+      char          bytes[3];
+      unsigned char size;
+      };
+
+   /// code points for 0x80 - 0x9F in Windows-1252, undefined positions keep the value like MultiByteToWideChar
+   constexpr std::array<char16_t, 32> cp1252_special = {
+      0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+      0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+      };
+
+   constexpr std::array<utf8_sequence, 128> utf8_table = []() {
+      std::array<utf8_sequence, 128> table { };
+      for (size_t i = 0; i < table.size(); ++i) {
+         char16_t const code = i < cp1252_special.size() ? cp1252_special[i] : static_cast<char16_t>(0x80 + i);
+         if (code < 0x800) table[i] = { { static_cast<char>(0xC0 | (code >> 6)), static_cast<char>(0x80 | (code & 0x3F)), 0 }, 2 };
+         else table[i] = { { static_cast<char>(0xE0 | (code >> 12)), static_cast<char>(0x80 | ((code >> 6) & 0x3F)),
+                             static_cast<char>(0x80 | (code & 0x3F)) }, 3 };
+         }
+      return table;
+      }();
+
+   /// \brief length of the run of ASCII characters at the begin of text
+   size_t ascii_run(char const* text, size_t size) {
+      size_t pos = 0;
+   #if defined(MY_UTF8_SSE2)
+      for (; pos + 16 <= size; pos += 16) {
+         auto const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(text + pos));
+         if (int const mask = _mm_movemask_epi8(block); mask != 0) return pos + std::countr_zero(static_cast<unsigned int>(mask));
+         }
+   #endif
+      for (; pos + 8 <= size; pos += 8) {
+         uint64_t block;
+         std::memcpy(&block, text + pos, sizeof(block));
+         if (block & 0x8080'8080'8080'8080ull) break;
+         }
+      while (pos < size && !(static_cast<unsigned char>(text[pos]) & 0x80)) ++pos;
+      return pos;
+      }
+   }
+
+
+void AppendAsUTF8(TMyTextBuffer& sink, std::string_view text) {
+   while (!text.empty()) {
+      auto const run = ascii_run(text.data(), text.size());
+      sink.Append(text.substr(0, run));
+      text.remove_prefix(run);
+      for (; !text.empty() && (static_cast<unsigned char>(text.front()) & 0x80); text.remove_prefix(1)) {
+         auto const& seq = utf8_table[static_cast<unsigned char>(text.front()) - 0x80];
+         sink.Append(std::string_view(seq.bytes, seq.size));
+         }
+      }
+   }
+
+
+TMyUTF8StreamBuf::TMyUTF8StreamBuf(TMyTextBuffer& pSink, bool boBOM, bool pMeasure) : sink(pSink), boMeasure(pMeasure) {
+   if (boBOM) sink.Append("\xEF\xBB\xBF"sv);
+   setp(buffer.data(), buffer.data() + buffer.size());
+   }
+
+TMyUTF8StreamBuf::int_type TMyUTF8StreamBuf::overflow(int_type ch) {
+   sync();
+   if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+      }
+   return traits_type::not_eof(ch);
+   }
+
+std::streamsize TMyUTF8StreamBuf::xsputn(char const* text, std::streamsize count) {
+   if (count <= epptr() - pptr()) {
+      std::memcpy(pptr(), text, static_cast<size_t>(count));
+      pbump(static_cast<int>(count));
+      }
+   else {  // large blocks are converted directly without the put area
+      sync();
+      Convert(std::string_view(text, static_cast<size_t>(count)));
+      }
+   return count;
+   }
+
+int TMyUTF8StreamBuf::sync() {
+   Convert(std::string_view(pbase(), static_cast<size_t>(pptr() - pbase())));
+   setp(buffer.data(), buffer.data() + buffer.size());
+   return 0;
+   }
+
+void TMyUTF8StreamBuf::Convert(std::string_view text) {
+   if (!boMeasure) [[likely]] AppendAsUTF8(sink, text);
+   else {
+      auto const start = std::chrono::steady_clock::now();
+      AppendAsUTF8(sink, text);
+      conversion += std::chrono::steady_clock::now() - start;
+      }
+   }
+
+
+TMyTextBuffer const& TMyUTF8Stream::Finish() {
+   flush();
+   if (text.Size() > 3 && text.Back() != '\n') text.push_back('\n');
+   return text;
+   }
@@ -0,0 +1,63 @@
+#pragma once
+/** \file
+   \brief output stream which converts the ANSI text (Windows-1252) of the generators to UTF-8 with BOM
+   \details the generators write their text with the encoding of the sources (Windows-1252). the stream
+            buffer converts the text while the generator writes into a string, there is no second pass
+            and no temporary file. the conversion uses a table for the characters beyond ASCII, runs of
+            ASCII characters are copied in blocks (SSE2 when available, otherwise 8 bytes in a word).
+   \version 1.0
+   \since Version 1.0
+   \date 17.10.2026 created as portable replacement for convertToUTF8WithBOM
+   \copyright copyright &copy; 2024. All rights reserved.
+   This project is released under the MIT License.
+*/
+
+#include <string>
+#include <string_view>
+#include <streambuf>
+#include <ostream>
+#include <array>
+#include <chrono>
+
+#include "MyTextBuffer.h"
+
+/// \brief append text in Windows-1252 to sink as UTF-8
+void AppendAsUTF8(TMyTextBuffer& sink, std::string_view text);
+
+/// \brief stream buffer which converts all written characters from Windows-1252 to UTF-8 into a text buffer
+class TMyUTF8StreamBuf : public std::streambuf {
+   TMyTextBuffer&                       sink;             ///< target for the converted text
+   std::array<char, 4096>               buffer;           ///< put area for the stream, converted when full or at sync
+   bool                                 boMeasure;        ///< measure the time for the conversion (instrumentation)
+   std::chrono::steady_clock::duration  conversion { };   ///< time used for the conversion, only with boMeasure
+public:
+   explicit TMyUTF8StreamBuf(TMyTextBuffer& pSink, bool boBOM = true, bool pMeasure = false);
+   TMyUTF8StreamBuf(TMyUTF8StreamBuf const&) = delete;
+   ~TMyUTF8StreamBuf() override { sync(); }
+
+   std::chrono::steady_clock::duration Conversion() const { return conversion; }
+
+protected:
+   int_type        overflow(int_type ch) override;
+   std::streamsize xsputn(char const* text, std::streamsize count) override;
+   int             sync() override;
+
+private:
+   void Convert(std::string_view text);
+   };
+
+/// \brief output stream for generators, the result is UTF-8 text with BOM
+class TMyUTF8Stream : public std::ostream {
+   TMyTextBuffer    text;             ///< converted text
+   TMyUTF8StreamBuf buf;              ///< converting stream buffer
+public:
+   /// \brief boMeasure measures the time of the conversion for the instrumentation of Create_All
+   explicit TMyUTF8Stream(bool boMeasure = false) : std::ostream(nullptr), buf(text, true, boMeasure) { rdbuf(&buf); }
+   TMyUTF8Stream(TMyUTF8Stream const&) = delete;
+
+   /// \brief time used for the conversion to UTF-8, zero without boMeasure
+   std::chrono::steady_clock::duration Conversion() const { return buf.Conversion(); }
+
+   /// \brief complete the text and return it, the last line ends always with a new line like the former file conversion
+   TMyTextBuffer const& Finish();
+   };